@@ -18,10 +18,12 @@ if (NOT WIN32)
   endif()
 
   add_executable(ftxui_benchmark
+    src/ftxui/component/benchmark_test.cpp
     src/ftxui/dom/benchmark_test.cpp
   )
   target_link_libraries(ftxui_benchmark
     PRIVATE dom
+    PRIVATE component
     PRIVATE benchmark::benchmark
     PRIVATE benchmark::benchmark_main
   )
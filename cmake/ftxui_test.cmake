@@ -29,6 +29,9 @@ add_executable(tests
   src/ftxui/component/component_test.cpp
   src/ftxui/component/component_test.cpp
   src/ftxui/component/container_test.cpp
+  src/ftxui/component/data_grid_test.cpp
+  src/ftxui/component/data_grid_view_test.cpp
+  src/ftxui/component/event_test.cpp
   src/ftxui/component/input_test.cpp
   src/ftxui/component/menu_test.cpp
   src/ftxui/component/modal_test.cpp
@@ -48,6 +51,7 @@ add_executable(tests
   src/ftxui/dom/flexbox_helper_test.cpp
   src/ftxui/dom/flexbox_test.cpp
   src/ftxui/dom/gauge_test.cpp
+  src/ftxui/dom/graph_source_test.cpp
   src/ftxui/dom/gridbox_test.cpp
   src/ftxui/dom/hbox_test.cpp
   src/ftxui/dom/scroll_indicator_test.cpp
@@ -58,7 +62,11 @@ add_executable(tests
   src/ftxui/dom/underlined_test.cpp
   src/ftxui/dom/vbox_test.cpp
   src/ftxui/screen/color_test.cpp
+  src/ftxui/screen/row_diff_test.cpp
+  src/ftxui/screen/screen_test.cpp
   src/ftxui/screen/string_test.cpp
+  src/ftxui/screen/terminal_probe_test.cpp
+  src/ftxui/screen/terminal_test.cpp
 )
 
 target_link_libraries(tests
@@ -15,6 +15,7 @@
 namespace ftxui {
 struct ButtonOption;
 struct CheckboxOption;
+struct DataGridOption;
 struct Event;
 struct InputOption;
 struct MenuOption;
@@ -94,6 +95,8 @@ ComponentDecorator Modal(Component modal, const bool* show_modal);
 Component Collapsible(ConstStringRef label,
                       Component child,
                       Ref<bool> show = false);
+
+Component DataGrid(int* selected, Ref<DataGridOption> option);
 }  // namespace ftxui
 
 #endif /* end of include guard: FTXUI_COMPONENT_HPP */
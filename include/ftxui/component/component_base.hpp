@@ -1,8 +1,9 @@
 #ifndef FTXUI_COMPONENT_BASE_HPP
 #define FTXUI_COMPONENT_BASE_HPP
 
-#include <memory>  // for unique_ptr
-#include <vector>  // for vector
+#include <cstdint>  // for uint64_t
+#include <memory>   // for unique_ptr
+#include <vector>   // for vector
 
 #include "ftxui/component/captured_mouse.hpp"  // for CaptureMouse
 #include "ftxui/dom/elements.hpp"              // for Element
@@ -11,6 +12,7 @@ namespace ftxui {
 
 class Delegate;
 class Focus;
+class ScreenInteractive;
 struct Event;
 
 namespace animation {
@@ -63,6 +65,10 @@ class ComponentBase {
   // keyboard.
   virtual bool Focusable() const;
 
+  // Same as Focusable(). While an event is dispatched, the result is cached
+  // until the tree or the active children change.
+  bool FocusableCached() const;
+
   // Whether this is the active child of its parent.
   bool Active() const;
   // Whether all the ancestors are active.
@@ -75,13 +81,63 @@ class ComponentBase {
   // Configure all the ancestors to give focus to this component.
   void TakeFocus();
 
+  // Render caching ------------------------------------------------------------
+  //
+  // A cacheable component reuses the Element it rendered last, until it is
+  // invalidated. This happens when:
+  // - Invalidate() is called on it, or on one of its descendants.
+  // - It, or one of its descendants, handles an event.
+  // - It, one of its ancestors or descendants, requested the animation frame
+  //   being run.
+  // - Its focus changes.
+  // The state a cacheable component displays is usually referenced through
+  // Ref<> or pointers. Call Invalidate() after modifying it from the outside.
+  // A component modifying its state on an event it doesn't handle, like a
+  // mouse hovering it, calls Invalidate() itself.
+  void SetCacheable(bool cacheable);
+  void Invalidate();
+  bool Invalidated() const;
+
+  // Same as Render(), but reuse the previous Element when this component
+  // hasn't been invalidated. Parents should use it on their children.
+  Element RenderCached();
+
  protected:
   CapturedMouse CaptureMouse(const Event& event);
 
+  // Events are dispatched along the focused path. A parent handling an event
+  // as focused tells its active child it is on the path too, with |focused|.
+  // The child then knows it is Active() and its ancestors too, without
+  // walking up the tree. See ReceivedFocused().
+  static bool SendEvent(const Component& child, Event event, bool focused);
+  bool ReceivedFocused() const;
+
+  // Run an animation step on a child. The animation frames it requests are
+  // attributed to it.
+  static void SendAnimation(const Component& child, animation::Params& params);
+
   Components children_;
 
  private:
+  friend ScreenInteractive;
+
+  // Record that the component being dispatched an event, an animation step, or
+  // rendered, requested an animation frame.
+  static void AnimationFrameRequested();
+  // Run an animation step on |root|, and invalidate the components which
+  // requested it.
+  static void RunAnimation(const Component& root, animation::Params& params);
+  // Invalidate this component, its ancestors and its descendants.
+  void InvalidateSubtree();
+
   ComponentBase* parent_ = nullptr;
+  mutable uint64_t focusable_epoch_ = 0;
+  mutable bool focusable_ = false;
+  bool cacheable_ = false;
+  bool invalidated_ = true;
+  bool animated_ = false;
+  bool rendered_focused_ = false;
+  Element rendered_;
 };
 
 }  // namespace ftxui
@@ -8,6 +8,7 @@
 #include <functional>                     // for function
 #include <optional>                       // for optional
 #include <string>                         // for string
+#include <vector>                         // for vector
 
 #include "ftxui/screen/color.hpp"  // for Color, Color::GrayDark, Color::White
 
@@ -164,6 +165,30 @@ struct RadioboxOption {
   Ref<int> focused_entry = 0;
 };
 
+/// @brief Option for the DataGrid component.
+/// @ingroup component
+struct DataGridOption {
+  /// The title of each column, displayed above the rows even when scrolling.
+  /// It defines the number of columns.
+  std::vector<std::string> header;
+
+  /// The number of rows. Called on every frame, so that rows can be added.
+  std::function<int()> rows;
+
+  /// The content of a cell. Only called for the visible rows.
+  std::function<std::string(int row, int column)> cell;
+  /// Same as |cell|, for cells which aren't text. Used instead when set.
+  std::function<Element(int row, int column)> cell_element;
+
+  /// The width of the columns is estimated from this number of rows, evenly
+  /// spread over the grid. Then, the columns widen to fit the visible rows.
+  int width_sample = 100;  // NOLINT
+
+  // Observers:
+  std::function<void()> on_change;  ///> Called when the selected row changes.
+  std::function<void()> on_enter;   ///> Called when the user presses enter.
+};
+
 }  // namespace ftxui
 
 #endif /* end of include guard: FTXUI_COMPONENT_COMPONENT_OPTIONS_HPP */
@@ -0,0 +1,89 @@
+#ifndef FTXUI_COMPONENT_DATA_GRID_VIEW_HPP
+#define FTXUI_COMPONENT_DATA_GRID_VIEW_HPP
+
+#include <functional>  // for function
+#include <string>      // for string
+#include <vector>      // for vector
+
+#include "ftxui/dom/elements.hpp"  // for Element
+
+namespace ftxui {
+
+struct DataGridOption;
+
+/// @brief A sorted and filtered view over the rows of a data source, without
+/// copying them. It maps the rows of the view to the rows of the source.
+///
+/// Rows appended to the source are sorted and filtered on their own, then
+/// merged into the view. Nothing else is recomputed.
+///
+/// ### Example
+///
+/// ```cpp
+/// DataGridView view([&] { return (int)data.size(); },
+///                   [&](int row, int column) { return data[row][column]; });
+/// view.Sort(1);
+/// view.Filter([&](int row) { return data[row][0] != "ok"; });
+///
+/// DataGridOption option;
+/// option.header = {"status", "name"};
+/// view.Bind(&option);
+/// auto grid = DataGrid(&selected, option);
+/// ```
+/// @ingroup component
+class DataGridView {
+ public:
+  using Rows = std::function<int()>;
+  using Cell = std::function<std::string(int row, int column)>;
+  using Less = std::function<bool(int row_a, int row_b)>;
+  using Keep = std::function<bool(int row)>;
+  using CellElement = std::function<Element(int row, int column)>;
+
+  DataGridView(Rows rows, Cell cell);
+
+  // Order the rows. Equal rows keep the order of the source.
+  void Sort(int column, bool ascending = true);
+  void Sort(Less less);
+  void Unsort();
+
+  // Display only the rows satisfying |keep|. nullptr displays every row.
+  void Filter(Keep keep);
+
+  // The number of rows of the view, and the source row of a given row.
+  int Size();
+  int Source(int row);
+  std::string Get(int row, int column);
+
+  // Make |option| display the view. The view must outlive the component.
+  // The cells are drawn by SetCellElement(), which receives the source rows.
+  // An |option->cell_element| set before Bind() is used as such.
+  void Bind(DataGridOption* option);
+  void SetCellElement(CellElement cell_element);
+
+ private:
+  void Update();
+  void Rebuild();
+  bool Before(int a, int b) const;
+
+  Rows rows_;
+  Cell cell_;
+  CellElement cell_element_;
+
+  Less less_;
+  int sort_column_ = -1;
+  bool ascending_ = true;
+  std::vector<std::string> keys_;  // The sorted column, for Sort(column).
+  Keep keep_;
+
+  int source_size_ = 0;
+  std::vector<int> order_;  // Every row, sorted.
+  std::vector<int> index_;  // The rows kept, sorted.
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_DATA_GRID_VIEW_HPP */
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -2,8 +2,11 @@
 #define FTXUI_COMPONENT_EVENT_HPP
 
 #include <ftxui/component/mouse.hpp>  // for Mouse
+#include <cstddef>                     // for size_t
+#include <cstdint>                     // for uint64_t
 #include <functional>
-#include <string>  // for string, operator==
+#include <memory>  // for shared_ptr
+#include <string>  // for string
 #include <vector>
 
 namespace ftxui {
@@ -58,7 +61,7 @@ struct Event {
 
   //--- Method section ---------------------------------------------------------
   bool is_character() const { return type_ == Type::Character; }
-  std::string character() const { return input_; }
+  std::string character() const { return input(); }
 
   bool is_mouse() const { return type_ == Type::Mouse; }
   struct Mouse& mouse() {
@@ -69,9 +72,14 @@ struct Event {
   int cursor_x() const { return cursor_.x; }
   int cursor_y() const { return cursor_.y; }
 
-  const std::string& input() const { return input_; }
+  // The raw input, built on demand.
+  std::string input() const;
 
-  bool operator==(const Event& other) const { return input_ == other.input_; }
+  // Events are compared by their key. Only long inputs, whose key is a hash,
+  // need to compare their bytes.
+  bool operator==(const Event& other) const {
+    return key_ == other.key_ && (size_ < sizeof(key_) || SameInput(other));
+  }
   bool operator!=(const Event& other) const { return !operator==(other); }
 
   //--- State section ----------------------------------------------------------
@@ -80,6 +88,11 @@ struct Event {
  private:
   friend ComponentBase;
   friend ScreenInteractive;
+
+  void SetInput(const char* data, size_t size);
+  const char* data() const;
+  bool SameInput(const Event& other) const;
+
   enum class Type {
     Unknown,
     Character,
@@ -97,7 +110,17 @@ struct Event {
     struct Mouse mouse_;
     struct Cursor cursor_;
   };
-  std::string input_;
+
+  // Inputs shorter than 8 bytes are their own key: their bytes, and their size
+  // in the last byte. Longer inputs are hashed.
+  uint64_t key_ = 0;
+
+  // The input is stored inline when it fits. Escape sequences, mouse reports
+  // included, and characters never need an allocation.
+  static constexpr size_t kInlineSize = 24;
+  size_t size_ = 0;
+  char inline_[kInlineSize] = {};
+  std::shared_ptr<const std::string> heap_;
 };
 
 }  // namespace ftxui
@@ -8,12 +8,14 @@
 #include <string>                        // for string
 #include <thread>                        // for thread
 #include <variant>                       // for variant
+#include <vector>                        // for vector
 
 #include "ftxui/component/animation.hpp"       // for TimePoint
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse
 #include "ftxui/component/event.hpp"           // for Event
 #include "ftxui/component/task.hpp"            // for Closure, Task
 #include "ftxui/screen/screen.hpp"             // for Screen
+#include "ftxui/screen/terminal.hpp"           // for Terminal::Output
 
 namespace ftxui {
 class ComponentBase;
@@ -29,6 +31,11 @@ class ScreenInteractive : public Screen {
   static ScreenInteractive Fullscreen();
   static ScreenInteractive FitComponent();
   static ScreenInteractive TerminalOutput();
+  static ScreenInteractive Headless(int dimx,
+                                    int dimy,
+                                    std::string input,
+                                    Terminal::Output output = nullptr,
+                                    bool use_alternative_screen = false);
 
   // Return the currently active screen, nullptr if none.
   static ScreenInteractive* Active();
@@ -47,6 +54,16 @@ class ScreenInteractive : public Screen {
   // temporarily uninstalled.
   Closure WithRestoredIO(Closure);
 
+  // Statistics about the frames drawn by the screen.
+  struct Stats {
+    int frames = 0;
+    int events = 0;
+    int animation_frames = 0;
+    size_t bytes = 0;               // The size of every frame, summed.
+    animation::Duration elapsed{};  // The time spent in Loop.
+  };
+  const Stats& stats() const { return stats_; }
+
  private:
   void Install();
   void Uninstall();
@@ -55,6 +72,10 @@ class ScreenInteractive : public Screen {
 
   void Draw(Component component);
   void SigStop();
+  void Write(const std::string& data);
+
+  animation::TimePoint Now() const;
+  bool HeadlessStep();
 
   ScreenInteractive* suspended_screen_ = nullptr;
   enum class Dimension {
@@ -65,10 +86,12 @@ class ScreenInteractive : public Screen {
   };
   Dimension dimension_ = Dimension::Fixed;
   bool use_alternative_screen_ = false;
+  struct HeadlessState;
   ScreenInteractive(int dimx,
                     int dimy,
                     Dimension dimension,
-                    bool use_alternative_screen);
+                    bool use_alternative_screen,
+                    std::shared_ptr<HeadlessState> headless = nullptr);
 
   Sender<Task> task_sender_;
   Receiver<Task> task_receiver_;
@@ -76,6 +99,14 @@ class ScreenInteractive : public Screen {
   std::string set_cursor_position;
   std::string reset_cursor_position;
 
+  // The bytes of the frame being drawn, reused from one frame to the next.
+  std::string frame_;
+
+  // The rows of the current and the previous frame, when using the alternative
+  // screen.
+  std::vector<std::string> rows_;
+  std::vector<std::string> previous_rows_;
+
   std::atomic<bool> quit_ = false;
   std::thread event_listener_;
   std::thread animation_listener_;
@@ -88,6 +119,11 @@ class ScreenInteractive : public Screen {
   bool mouse_captured = false;
   bool previous_frame_resized_ = false;
 
+  Stats stats_;
+
+  // Not null for the screens built with `Headless`.
+  std::shared_ptr<HeadlessState> headless_;
+
  public:
   class Private {
    public:
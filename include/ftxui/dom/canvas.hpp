@@ -1,13 +1,15 @@
 #ifndef FTXUI_DOM_CANVAS_HPP
 #define FTXUI_DOM_CANVAS_HPP
 
-#include <cstddef>        // for size_t
+#include <cstdint>        // for uint8_t
 #include <functional>     // for function
 #include <string>         // for string
 #include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
 
+#include "ftxui/screen/box.hpp"     // for Box
 #include "ftxui/screen/color.hpp"   // for Color
-#include "ftxui/screen/screen.hpp"  // for Pixel
+#include "ftxui/screen/screen.hpp"  // for Pixel, Screen
 
 #ifdef DrawText
 // Workaround for WinUsr.h (via Windows.h) defining macros that break things.
@@ -29,6 +31,11 @@ struct Canvas {
 
   using Stylizer = std::function<void(Pixel&)>;
 
+  struct Point {
+    int x = 0;
+    int y = 0;
+  };
+
   // Draws using braille characters --------------------------------------------
   void DrawPointOn(int x, int y);
   void DrawPointOff(int x, int y);
@@ -52,6 +59,22 @@ struct Canvas {
   void DrawPointEllipseFilled(int x, int y, int r1, int r2, const Color& color);
   void DrawPointEllipseFilled(int x, int y, int r1, int r2, const Stylizer& s);
 
+  // Draws many braille dots at once. The style is applied once per cell.
+  void DrawPointPolyline(const std::vector<Point>& points);
+  void DrawPointPolyline(const std::vector<Point>& points, const Stylizer& s);
+  void DrawPointPolyline(const std::vector<Point>& points, const Color& color);
+  void DrawPointScatter(const std::vector<Point>& points);
+  void DrawPointScatter(const std::vector<Point>& points, const Stylizer& s);
+  void DrawPointScatter(const std::vector<Point>& points, const Color& color);
+  void DrawPointPolygonFilled(const std::vector<Point>& points);
+  void DrawPointPolygonFilled(const std::vector<Point>& points,
+                              const Stylizer& s);
+  void DrawPointPolygonFilled(const std::vector<Point>& points,
+                              const Color& color);
+  void DrawPointHistogram(const std::vector<int>& values);
+  void DrawPointHistogram(const std::vector<int>& values, const Stylizer& s);
+  void DrawPointHistogram(const std::vector<int>& values, const Color& color);
+
   // Draw using box characters -------------------------------------------------
   // Block are of size 1x2. y is considered to be a multiple of 2.
   void DrawBlockOn(int x, int y);
@@ -97,37 +120,81 @@ struct Canvas {
   // y is considered to be a multiple of 4.
   void Style(int x, int y, const Stylizer& style);
 
+  // Move the content by (dx, dy). The uncovered area is left empty.
+  // x is considered to be a multiple of 2.
+  // y is considered to be a multiple of 4.
+  void Shift(int dx, int dy);
+
+  // Copy the canvas into |screen| at the top left corner of |box|. Only the
+  // cells modified since the previous call are converted into Pixels again.
+  void DrawOn(Screen& screen, const Box& box) const;
+
  private:
   bool IsIn(int x, int y) const {
     return x >= 0 && x < width_ && y >= 0 && y < height_;
   }
-  enum CellType {
+  enum CellType : uint8_t {
     kBraille,
     kBlock,
     kText,
   };
+
+  // Dense per-cell layer. `mask` holds the braille dots or the block quadrants,
+  // depending on `type`.
   struct Cell {
     CellType type = kText;
-    Pixel content;
-  };
-  struct XY {
-    int x;
-    int y;
-    bool operator==(const XY& other) const {
-      return x == other.x && y == other.y;
-    }
+    uint8_t mask = 0;
   };
 
-  struct XYHash {
-    size_t operator()(const XY& xy) const {
-      constexpr size_t shift = 1024;
-      return size_t(xy.x) * shift + size_t(xy.y);
+  // Return the cell containing the point (x,y), converted to |type|. Changing
+  // the type of a cell clears its mask.
+  Cell& CellAt(int x, int y, CellType type) {
+    const int index = x / 2 + (y / 4) * cells_x_;
+    MarkDirty(index);
+    Cell& cell = cells_[index];
+    if (cell.type != type) {
+      cell.type = type;
+      cell.mask = 0;
     }
-  };
+    return cell;
+  }
 
   int width_ = 0;
   int height_ = 0;
-  std::unordered_map<XY, Cell, XYHash> storage_;
+  // Rasterization of the braille shapes. A shape styles each cell at most
+  // once, even when it sets several of its dots.
+  void NewShape();
+  void StyleOnce(int index, const Stylizer& style);
+  void PlotPoint(int x, int y, const Stylizer& style);
+  void PlotLine(int x1, int y1, int x2, int y2, const Stylizer& style);
+  void PlotSpan(int x_begin, int x_end, int y, const Stylizer& style);
+  void PlotColumn(int x, int y_begin, int y_end, const Stylizer& style);
+
+  int cells_x_ = 0;
+  int cells_y_ = 0;
+  std::vector<Cell> cells_;
+  // Sparse layer: the style of the cells, and the character of text cells.
+  std::unordered_map<int, Pixel> pixels_;
+
+  // The Pixels last drawn by DrawOn(). Once they exist, the modified cells are
+  // recorded, so that only those are converted again.
+  struct Cache {
+    std::vector<Pixel> pixels;
+    std::vector<bool> dirty;
+    std::vector<int> dirty_list;
+  };
+  void MarkDirty(int index) {
+    if (cache_.pixels.empty() || cache_.dirty[index]) {
+      return;
+    }
+    cache_.dirty[index] = true;
+    cache_.dirty_list.push_back(index);
+  }
+  mutable Cache cache_;
+
+  // styled_[i] is the last shape having styled the cell |i|.
+  uint32_t shape_ = 0;
+  std::vector<uint32_t> styled_;
 };
 
 }  // namespace ftxui
@@ -6,6 +6,7 @@
 
 #include "ftxui/dom/canvas.hpp"
 #include "ftxui/dom/flexbox_config.hpp"
+#include "ftxui/dom/graph_source.hpp"
 #include "ftxui/dom/node.hpp"
 #include "ftxui/screen/box.hpp"
 #include "ftxui/screen/color.hpp"
@@ -73,6 +74,7 @@ Element paragraphAlignRight(const std::string& text);
 Element paragraphAlignCenter(const std::string& text);
 Element paragraphAlignJustify(const std::string& text);
 Element graph(GraphFunction);
+Element graph(std::shared_ptr<GraphSource>);
 Element emptyElement();
 Element canvas(ConstRef<Canvas>);
 Element canvas(int width, int height, std::function<void(Canvas&)>);
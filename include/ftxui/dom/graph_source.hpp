@@ -0,0 +1,91 @@
+#ifndef FTXUI_DOM_GRAPH_SOURCE_HPP
+#define FTXUI_DOM_GRAPH_SOURCE_HPP
+
+#include <atomic>   // for atomic
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <deque>    // for deque
+#include <memory>   // for unique_ptr
+#include <vector>   // for vector
+
+namespace ftxui {
+
+// A stream of samples, displayed by `graph(std::shared_ptr<GraphSource>)`.
+//
+// Usage:
+// ------
+//
+// auto source = std::make_shared<GraphSource>(/*samples_per_column=*/100);
+//
+// [any thread] source->Push(value);
+// [ui thread]  auto document = graph(source);
+//
+// Push() is lock-free and can be called concurrently from any number of
+// threads. The samples are buffered into a ring of |capacity| samples, until
+// the graph is rendered. If the producers outrun the rendering by more than
+// |capacity| samples, the oldest ones are dropped.
+//
+// Every group of |samples_per_column| consecutive samples is reduced into one
+// column of the graph, using the |decimation| function. Columns are computed
+// once, when their last sample is received. Only the completed columns are
+// displayed, the most recent one on the right.
+class GraphSource {
+ public:
+  enum class Decimation {
+    Min,   ///< The column displays the smallest sample.
+    Max,   ///< The column displays the largest sample.
+    Mean,  ///< The column displays the average of its samples.
+  };
+
+  explicit GraphSource(int samples_per_column = 1,
+                       Decimation decimation = Decimation::Mean,
+                       size_t capacity = 1 << 14);  // NOLINT
+  GraphSource(const GraphSource&) = delete;
+  GraphSource& operator=(const GraphSource&) = delete;
+  ~GraphSource();
+
+  // Producer side: thread safe.
+  void Push(float value);
+
+  // Consumer side: to be used from the thread rendering the graph.
+  void SetRange(float min, float max);
+  const std::vector<int>& Heights(int width, int height);
+
+ private:
+  void Drain();
+  void Add(float value);
+
+  // The ring of samples. A slot holds a sample and its sequence, the index of
+  // the sample plus one, truncated to 32 bits. Both are packed into a single
+  // word, so that they are always read and written together.
+  struct Slot {
+    std::atomic<uint64_t> word{0};
+  };
+  std::unique_ptr<Slot[]> slots_;  // NOLINT
+  uint64_t mask_;
+  std::atomic<uint64_t> head_{0};
+  uint64_t tail_ = 0;
+
+  struct Column {
+    float min = 0.F;
+    float max = 0.F;
+    float sum = 0.F;
+    int count = 0;
+  };
+  int samples_per_column_;
+  Decimation decimation_;
+  Column current_;
+  std::deque<Column> columns_;
+
+  float range_min_ = 0.F;
+  float range_max_ = 0.F;
+  std::vector<int> heights_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_GRAPH_SOURCE_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
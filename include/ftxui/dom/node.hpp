@@ -49,14 +49,39 @@ class Node {
   };
   virtual void Check(Status* status);
 
+  // Convergent layout: After the first iteration, only the subtrees that asked
+  // for another one are laid out again. Containers should use these functions
+  // on their children instead of calling the steps above directly.
+  void CheckLayout(Status* status);
+  void ComputeRequirementIfNeeded();
+  void SetBoxIfNeeded(Box box);
+  bool need_layout() const { return need_layout_; }
+  bool requirement_final() const { return requirement_final_; }
+  bool concurrent_render() const { return concurrent_render_; }
+
  protected:
   Elements children_;
   Requirement requirement_;
   Box box_;
+
+  // Set once |requirement_| can't change anymore. For instance by leaves
+  // computing it at construction. ComputeRequirementIfNeeded() skips them.
+  bool requirement_final_ = false;
+
+  // Whether this subtree draws only inside the boxes of its nodes, without
+  // modifying the Screen's state. It can then be drawn concurrently with its
+  // siblings. See ftxui::SetParallelLayout().
+  bool concurrent_render_ = true;
+
+ private:
+  bool need_layout_ = true;
 };
 
 void Render(Screen& screen, const Element& element);
 void Render(Screen& screen, Node* node);
+void Render(Screen& screen, Node* node, Node::Status* status);
+
+void SetParallelLayout(int threads);
 
 }  // namespace ftxui
 
@@ -1,6 +1,7 @@
 #ifndef FTXUI_DOM_TABLE
 #define FTXUI_DOM_TABLE
 
+#include <cstdint>  // for uint8_t
 #include <memory>
 #include <string>  // for string
 #include <vector>  // for vector
@@ -50,8 +51,22 @@ class Table {
 
  private:
   void Initialize(std::vector<std::vector<Element>>);
+  void DecorateSlot(int x, int y, const Decorator& decorator);
+  void SetGlyph(int x, int y, BorderStyle border, int index);
   friend TableSelection;
-  std::vector<std::vector<Element>> elements_;
+
+  // The table is a grid of (2 * input_dim_x_ + 1) x (2 * input_dim_y_ + 1)
+  // slots. The cells are at odd coordinates. The other slots are the lines
+  // and the corners in between. Everything is stored column by column.
+  Elements cells_;
+
+  // The border character of every slot, 0 for none. See Table::SetGlyph.
+  std::vector<uint8_t> glyphs_;
+
+  // The lines and corners, only once decorated. The others are drawn directly
+  // from |glyphs_|.
+  Elements decorated_;
+
   int input_dim_x_ = 0;
   int input_dim_y_ = 0;
   int dim_x_ = 0;
@@ -3,6 +3,7 @@
 
 #include <cstdint>  // for uint8_t
 #include <string>   // for wstring
+#include <vector>   // for vector
 
 #ifdef RGB
 // Workaround for wingdi.h (via Windows.h) defining macros that break things.
@@ -28,6 +29,7 @@ class Color {
   static Color RGB(uint8_t red, uint8_t green, uint8_t blue);
   static Color HSV(uint8_t hue, uint8_t saturation, uint8_t value);
   static Color Interpolate(float t, const Color& a, const Color& b);
+  static std::vector<Color> Gradient(int count, const Color& a, const Color& b);
 
   //---------------------------
   // List of colors:
@@ -305,6 +307,7 @@ class Color {
   bool operator!=(const Color& rhs) const;
 
   std::string Print(bool is_background_color) const;
+  void PrintTo(std::string& out, bool is_background_color) const;
 
  private:
   enum class ColorType : uint8_t {
@@ -313,6 +316,7 @@ class Color {
     Palette256,
     TrueColor,
   };
+  void GetRGB(uint8_t* red, uint8_t* green, uint8_t* blue) const;
   ColorType type_ = ColorType::Palette1;
   uint8_t red_ = 0;
   uint8_t green_ = 0;
@@ -2,6 +2,7 @@
 #define FTXUI_SCREEN_SCREEN_HPP
 
 #include <memory>
+#include <mutex>   // for mutex
 #include <string>  // for string, allocator, basic_string
 #include <vector>  // for vector
 
@@ -65,6 +66,10 @@ class Screen {
   std::string ToString();
   void Print();
 
+  // Convert the row |y| into a printable string. It starts and ends with the
+  // default style.
+  std::string RowToString(int y) const;
+
   // Get screen dimensions.
   int dimx() const { return dimx_; }
   int dimy() const { return dimy_; }
@@ -75,6 +80,9 @@ class Screen {
   // Fill with space.
   void Clear();
 
+  // Mark box drawing characters to be merged with the adjacent ones. Only the
+  // marked pixels are visited by ApplyShader().
+  void MarkAutomerge(Box box);
   void ApplyShader();
 
   struct Cursor {
@@ -93,6 +101,15 @@ class Screen {
   Cursor cursor_;
 
  private:
+  // The areas marked by MarkAutomerge(), until ApplyShader().
+  std::vector<Box> automerge_;
+  struct Mutex {
+    Mutex() = default;
+    Mutex(const Mutex&) {}
+    Mutex& operator=(const Mutex&) { return *this; }
+    std::mutex mutex;
+  };
+  Mutex automerge_mutex_;
 };
 
 }  // namespace ftxui
@@ -1,6 +1,9 @@
 #ifndef FTXUI_SCREEN_TERMINAL_HPP
 #define FTXUI_SCREEN_TERMINAL_HPP
 
+#include <functional>   // for function
+#include <string_view>  // for string_view
+
 namespace ftxui {
 struct Dimensions {
   int dimx;
@@ -20,6 +23,18 @@ enum Color {
 Color ColorSupport();
 void SetColorSupport(Color color);
 
+bool SynchronizedOutputSupport();
+void SetSynchronizedOutputSupport(bool supported);
+
+// Query the terminal, and update the capabilities above.
+bool Probe(int timeout_ms = 100, bool use_cache = true);  // NOLINT
+
+// Where the output is written. By default, the standard output.
+using Output = std::function<void(std::string_view)>;
+void SetOutput(Output output);
+void SetOutputFileDescriptor(int fd);
+void Write(std::string_view data);
+
 }  // namespace Terminal
 
 }  // namespace ftxui
@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+
+#include <string>  // for string, to_string
+#include <vector>  // for vector
+
+#include "ftxui/component/component.hpp"  // for Menu
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+
+namespace ftxui {
+
+// Replay a session, moving up and down a menu, with a headless screen. The
+// second argument draws on the alternative screen, like `Fullscreen`.
+static void BenchmarkHeadlessMenu(benchmark::State& state) {
+  std::vector<std::string> entries;
+  for (int i = 0; i < 100; ++i) {
+    entries.push_back("entry " + std::to_string(i));
+  }
+  int selected = 0;
+  auto menu = Menu(&entries, &selected);
+
+  std::string session;
+  for (int i = 0; i < state.range(0); ++i) {
+    session += (i / 50) % 2 ? "\x1B[A" : "\x1B[B";
+  }
+
+  int frames = 0;
+  size_t bytes = 0;
+  for (auto _ : state) {
+    auto screen = ScreenInteractive::Headless(80, 25, session, nullptr,
+                                              state.range(1) != 0);
+    screen.Loop(menu);
+    frames += screen.stats().frames;
+    bytes += screen.stats().bytes;
+  }
+  state.counters["frames/s"] =
+      benchmark::Counter(double(frames), benchmark::Counter::kIsRate);
+  state.counters["bytes/frame"] = double(bytes) / double(frames);
+}
+BENCHMARK(BenchmarkHeadlessMenu)->Args({1000, 0})->Args({1000, 1});
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
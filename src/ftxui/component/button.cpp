@@ -150,8 +150,12 @@ Component Button(ConstStringRef label,
     }
 
     bool OnMouseEvent(Event event) {
-      mouse_hover_ =
+      const bool mouse_hover =
           box_.Contain(event.mouse().x, event.mouse().y) && CaptureMouse(event);
+      if (mouse_hover_ != mouse_hover) {
+        mouse_hover_ = mouse_hover;
+        Invalidate();
+      }
 
       if (!mouse_hover_) {
         return false;
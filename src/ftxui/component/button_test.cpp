@@ -29,6 +29,18 @@ Event MousePressed(int x, int y) {
   return Event::Mouse("jjj", mouse);
 }
 
+Event MouseMoved(int x, int y) {
+  Mouse mouse;
+  mouse.button = Mouse::None;
+  mouse.motion = Mouse::Pressed;
+  mouse.shift = false;
+  mouse.meta = false;
+  mouse.control = false;
+  mouse.x = x;
+  mouse.y = y;
+  return Event::Mouse("jjj", mouse);
+}
+
 }  // namespace
 
 using namespace std::chrono_literals;
@@ -188,6 +200,25 @@ TEST(ButtonTest, Animation) {
   }
 }
 
+// The hover isn't handled, but modifies how the button is drawn.
+TEST(ButtonTest, HoverInvalidates) {
+  auto button = Button("button", [] {});
+  button->SetCacheable(true);
+  Screen screen(10, 3);
+  Render(screen, button->RenderCached());
+  EXPECT_FALSE(button->Invalidated());
+
+  EXPECT_FALSE(button->OnEvent(MouseMoved(1, 1)));
+  EXPECT_TRUE(button->Invalidated());
+  Render(screen, button->RenderCached());
+
+  EXPECT_FALSE(button->OnEvent(MouseMoved(2, 1)));
+  EXPECT_FALSE(button->Invalidated());
+
+  EXPECT_FALSE(button->OnEvent(MouseMoved(20, 1)));
+  EXPECT_TRUE(button->Invalidated());
+}
+
 }  // namespace ftxui
 
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
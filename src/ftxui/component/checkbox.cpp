@@ -47,7 +47,7 @@ class CheckboxBase : public ComponentBase {
       return OnMouseEvent(event);
     }
 
-    hovered_ = false;
+    SetHovered(false);
     if (event == Event::Character(' ') || event == Event::Return) {
       *state_ = !*state_;
       option_->on_change();
@@ -58,7 +58,7 @@ class CheckboxBase : public ComponentBase {
   }
 
   bool OnMouseEvent(Event event) {
-    hovered_ = box_.Contain(event.mouse().x, event.mouse().y);
+    SetHovered(box_.Contain(event.mouse().x, event.mouse().y));
 
     if (!CaptureMouse(event)) {
       return false;
@@ -80,6 +80,13 @@ class CheckboxBase : public ComponentBase {
 
   bool Focusable() const final { return true; }
 
+  void SetHovered(bool hovered) {
+    if (hovered_ != hovered) {
+      hovered_ = hovered;
+      Invalidate();
+    }
+  }
+
   ConstStringRef label_;
   bool* const state_;
   bool hovered_ = false;
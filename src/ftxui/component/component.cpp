@@ -1,4 +1,4 @@
-#include <algorithm>  // for find_if
+#include <algorithm>  // for find, find_if, remove
 #include <cassert>    // for assert
 #include <cstddef>    // for size_t
 #include <iterator>   // for begin, end
@@ -20,10 +20,62 @@ namespace ftxui {
 
 namespace {
 class CaptureMouseImpl : public CapturedMouseInterface {};
+
+// The event being dispatched. The cached focusable status of the components
+// is valid while |epoch| doesn't change.
+struct Dispatch {
+  int depth = 0;
+  uint64_t epoch = 1;
+  const ComponentBase* focused_receiver = nullptr;
+
+  // The component handling an event, an animation step, or being rendered.
+  ComponentBase* receiver = nullptr;
+  // The components which requested the next animation frame, and the ones
+  // which requested the one being run.
+  std::vector<ComponentBase*> animated;
+  std::vector<ComponentBase*> animating;
+  // Whether an animation frame was requested outside of any component.
+  bool animated_unknown = false;
+};
+thread_local Dispatch g_dispatch;  // NOLINT
+
+// Invalidate the cached focusable status.
+void NewEpoch() {
+  g_dispatch.epoch++;
+}
+
+// Set the receiver of the dispatch, until the end of the scope.
+class ReceiverScope {
+ public:
+  explicit ReceiverScope(ComponentBase* receiver)
+      : previous_(g_dispatch.receiver) {
+    g_dispatch.receiver = receiver;
+  }
+  ~ReceiverScope() { g_dispatch.receiver = previous_; }
+  ReceiverScope(const ReceiverScope&) = delete;
+  ReceiverScope(ReceiverScope&&) = delete;
+  ReceiverScope& operator=(const ReceiverScope&) = delete;
+  ReceiverScope& operator=(ReceiverScope&&) = delete;
+
+ private:
+  ComponentBase* previous_;
+};
+
+void Erase(std::vector<ComponentBase*>& components,
+           const ComponentBase* component) {
+  components.erase(
+      std::remove(components.begin(), components.end(), component),
+      components.end());
+}
+
 }  // namespace
 
 ComponentBase::~ComponentBase() {
   DetachAllChildren();
+  if (animated_) {
+    Erase(g_dispatch.animated, this);
+    Erase(g_dispatch.animating, this);
+  }
 }
 
 /// @brief Return the parent ComponentBase, or nul if any.
@@ -51,6 +103,7 @@ size_t ComponentBase::ChildCount() const {
 /// @@param child The child to be attached.
 /// @ingroup component
 void ComponentBase::Add(Component child) {
+  NewEpoch();
   child->Detach();
   child->parent_ = this;
   children_.push_back(std::move(child));
@@ -64,6 +117,7 @@ void ComponentBase::Detach() {
   if (parent_ == nullptr) {
     return;
   }
+  NewEpoch();
   auto it = std::find_if(std::begin(parent_->children_),  //
                          std::end(parent_->children_),    //
                          [this](const Component& that) {  //
@@ -88,7 +142,7 @@ void ComponentBase::DetachAllChildren() {
 /// @ingroup component
 Element ComponentBase::Render() {
   if (children_.size() == 1) {
-    return children_.front()->Render();
+    return children_.front()->RenderCached();
   }
 
   return text("Not implemented component");
@@ -101,8 +155,14 @@ Element ComponentBase::Render() {
 /// true. If none returns true, return false.
 /// @ingroup component
 bool ComponentBase::OnEvent(Event event) {  // NOLINT
-  for (Component& child : children_) {      // NOLINT
-    if (child->OnEvent(event)) {
+  // The active child is on the focused path, when this component is.
+  ComponentBase* active = nullptr;
+  if (ReceivedFocused()) {
+    active = ActiveChild().get();
+  }
+  for (Component& child : children_) {  // NOLINT
+    if (SendEvent(child, event, active && child.get() == active)) {
+      child->Invalidate();
       return true;
     }
   }
@@ -115,7 +175,7 @@ bool ComponentBase::OnEvent(Event event) {  // NOLINT
 /// @ingroup component
 void ComponentBase::OnAnimation(animation::Params& params) {
   for (Component& child : children_) {
-    child->OnAnimation(params);
+    SendAnimation(child, params);
   }
 }
 
@@ -124,7 +184,7 @@ void ComponentBase::OnAnimation(animation::Params& params) {
 /// @ingroup component
 Component ComponentBase::ActiveChild() {
   for (auto& child : children_) {
-    if (child->Focusable()) {
+    if (child->FocusableCached()) {
       return child;
     }
   }
@@ -137,7 +197,7 @@ Component ComponentBase::ActiveChild() {
 /// @ingroup component
 bool ComponentBase::Focusable() const {
   for (const Component& child : children_) {  // NOLINT
-    if (child->Focusable()) {
+    if (child->FocusableCached()) {
       return true;
     }
   }
@@ -160,7 +220,7 @@ bool ComponentBase::Focused() const {
   while (current && current->Active()) {
     current = current->parent_;
   }
-  return !current && Focusable();
+  return !current && FocusableCached();
 }
 
 /// @brief Make the |child| to be the "active" one.
@@ -178,6 +238,7 @@ void ComponentBase::SetActiveChild(Component child) {  // NOLINT
 /// @brief Configure all the ancestors to give focus to this component.
 /// @ingroup component
 void ComponentBase::TakeFocus() {
+  NewEpoch();
   ComponentBase* child = this;
   while (ComponentBase* parent = child->parent_) {
     parent->SetActiveChild(child);
@@ -185,6 +246,54 @@ void ComponentBase::TakeFocus() {
   }
 }
 
+/// @brief Allow this component to reuse its previous Element, until it is
+/// invalidated.
+/// @param cacheable Whether the component can be cached.
+/// @see Invalidate
+/// @see RenderCached
+/// @ingroup component
+void ComponentBase::SetCacheable(bool cacheable) {
+  cacheable_ = cacheable;
+  rendered_ = nullptr;
+}
+
+/// @brief Mark this component and its ancestors as needing a new Render().
+/// This must be called from the thread running the ScreenInteractive loop. Use
+/// ScreenInteractive::Post from other threads.
+/// @ingroup component
+void ComponentBase::Invalidate() {
+  NewEpoch();
+  for (ComponentBase* it = this; it; it = it->parent_) {
+    it->invalidated_ = true;
+  }
+}
+
+/// @brief Whether Invalidate() was called since the last RenderCached().
+/// @ingroup component
+bool ComponentBase::Invalidated() const {
+  return invalidated_;
+}
+
+/// @brief Draw the component, reusing the previous Element of cacheable
+/// components when they haven't been invalidated.
+/// @see SetCacheable
+/// @ingroup component
+Element ComponentBase::RenderCached() {
+  const ReceiverScope scope(this);
+  if (!cacheable_) {
+    invalidated_ = false;
+    return Render();
+  }
+
+  const bool focused = Focused();
+  if (invalidated_ || !rendered_ || rendered_focused_ != focused) {
+    rendered_ = Render();
+    rendered_focused_ = focused;
+    invalidated_ = false;
+  }
+  return rendered_;
+}
+
 /// @brief Take the CapturedMouse if available. There is only one component of
 /// them. It represents a component taking priority over others.
 /// @param event
@@ -196,6 +305,107 @@ CapturedMouse ComponentBase::CaptureMouse(const Event& event) {  // NOLINT
   return std::make_unique<CaptureMouseImpl>();
 }
 
+/// @brief Send an event to a child.
+/// @param child The child receiving the event.
+/// @param event The event.
+/// @param focused Whether the child is the active child of a focused parent.
+/// @return True when the event has been handled.
+/// @ingroup component
+bool ComponentBase::SendEvent(const Component& child,
+                              Event event,
+                              bool focused) {
+  // A new dispatch starts with fresh focusable statuses.
+  if (g_dispatch.depth == 0) {
+    NewEpoch();
+  }
+  const ReceiverScope scope(child.get());
+  const ComponentBase* previous = g_dispatch.focused_receiver;
+  g_dispatch.depth++;
+  g_dispatch.focused_receiver = focused ? child.get() : nullptr;
+  const bool handled = child->OnEvent(std::move(event));
+  g_dispatch.focused_receiver = previous;
+  g_dispatch.depth--;
+  return handled;
+}
+
+/// @brief Run an animation step on a child.
+/// @param child The child receiving the animation step.
+/// @param params The parameters of the animation.
+/// @ingroup component
+void ComponentBase::SendAnimation(const Component& child,
+                                  animation::Params& params) {
+  const ReceiverScope scope(child.get());
+  child->OnAnimation(params);
+}
+
+// static
+void ComponentBase::AnimationFrameRequested() {
+  ComponentBase* receiver = g_dispatch.receiver;
+  if (!receiver) {
+    g_dispatch.animated_unknown = true;
+    return;
+  }
+  auto& animated = g_dispatch.animated;
+  if (std::find(animated.begin(), animated.end(), receiver) == animated.end()) {
+    receiver->animated_ = true;
+    animated.push_back(receiver);
+  }
+}
+
+// static
+void ComponentBase::RunAnimation(const Component& root,
+                                 animation::Params& params) {
+  // The frames requested from now on are for the next animation step.
+  g_dispatch.animating.clear();
+  g_dispatch.animating.swap(g_dispatch.animated);
+  const bool unknown = g_dispatch.animated_unknown;
+  g_dispatch.animated_unknown = false;
+
+  SendAnimation(root, params);
+
+  if (unknown) {
+    root->InvalidateSubtree();
+  } else {
+    for (ComponentBase* component : g_dispatch.animating) {
+      component->InvalidateSubtree();
+    }
+  }
+  g_dispatch.animating.clear();
+}
+
+void ComponentBase::InvalidateSubtree() {
+  Invalidate();
+  std::vector<ComponentBase*> stack = {this};
+  while (!stack.empty()) {
+    ComponentBase* component = stack.back();
+    stack.pop_back();
+    component->invalidated_ = true;
+    for (const Component& child : component->children_) {
+      stack.push_back(child.get());
+    }
+  }
+}
+
+/// @brief Whether the event being handled was sent by a focused parent to
+/// this, its active child.
+/// @ingroup component
+bool ComponentBase::ReceivedFocused() const {
+  return g_dispatch.focused_receiver == this;
+}
+
+/// @brief Same as Focusable(), but cached while an event is dispatched.
+/// @ingroup component
+bool ComponentBase::FocusableCached() const {
+  if (g_dispatch.depth == 0) {
+    return Focusable();
+  }
+  if (focusable_epoch_ != g_dispatch.epoch) {
+    focusable_ = Focusable();
+    focusable_epoch_ = g_dispatch.epoch;
+  }
+  return focusable_;
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -3,6 +3,8 @@
 
 #include "ftxui/component/component.hpp"       // for Make
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
+#include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/dom/elements.hpp"              // for text
 
 namespace ftxui {
 
@@ -169,6 +171,53 @@ TEST(ComponentTest, NonFocusableAreNotFocused) {
   EXPECT_EQ(child->ActiveChild(), nullptr);
 }
 
+TEST(ComponentTest, CacheableReusesElement) {
+  int render_count = 0;
+  auto panel = Renderer([&] {
+    render_count++;
+    return text("panel");
+  });
+  panel->SetCacheable(true);
+  auto other = Renderer([] { return text("other"); });
+  auto root = Container::Vertical({panel, other});
+
+  auto first = panel->RenderCached();
+  root->RenderCached();
+  root->RenderCached();
+  EXPECT_EQ(render_count, 1);
+  EXPECT_EQ(panel->RenderCached(), first);
+
+  other->Invalidate();
+  EXPECT_TRUE(root->Invalidated());
+  EXPECT_FALSE(panel->Invalidated());
+  root->RenderCached();
+  EXPECT_EQ(render_count, 1);
+
+  panel->Invalidate();
+  root->RenderCached();
+  EXPECT_EQ(render_count, 2);
+}
+
+TEST(ComponentTest, CacheableInvalidatedByEvent) {
+  int render_count = 0;
+  auto button = Button("button", [] {});
+  auto panel = Renderer(button, [&] {
+    render_count++;
+    return button->Render();
+  });
+  panel->SetCacheable(true);
+  auto root = Container::Vertical({panel});
+
+  root->RenderCached();
+  root->RenderCached();
+  EXPECT_EQ(render_count, 1);
+
+  EXPECT_TRUE(root->OnEvent(Event::Return));
+  EXPECT_TRUE(panel->Invalidated());
+  root->RenderCached();
+  EXPECT_EQ(render_count, 2);
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
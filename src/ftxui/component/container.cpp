@@ -1,5 +1,7 @@
-#include <algorithm>  // for max, min
-#include <cstddef>    // for size_t
+#include <algorithm>  // for max, min, partition_point, set_union, sort, unique
+#include <cstddef>    // for size_t, ptrdiff_t
+#include <deque>      // for deque
+#include <iterator>   // for back_inserter
 #include <memory>  // for make_shared, __shared_ptr_access, allocator, shared_ptr, allocator_traits<>::value_type
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
@@ -28,11 +30,14 @@ class ContainerBase : public ComponentBase {
       return OnMouseEvent(event);
     }
 
-    if (!Focused()) {
+    // A parent handling the event as focused already checked the ancestors.
+    if (ReceivedFocused() ? !FocusableCached() : !Focused()) {
       return false;
     }
 
-    if (ActiveChild() && ActiveChild()->OnEvent(event)) {
+    Component active_child = ActiveChild();
+    if (active_child && SendEvent(active_child, event, /*focused=*/true)) {
+      active_child->Invalidate();
       return true;
     }
 
@@ -51,6 +56,7 @@ class ContainerBase : public ComponentBase {
     for (size_t i = 0; i < children_.size(); ++i) {
       if (children_[i].get() == child) {
         *selector_ = (int)i;
+        Invalidate();  // Also invalidates the cached focusable statuses.
         return;
       }
     }
@@ -60,17 +66,59 @@ class ContainerBase : public ComponentBase {
   // Handlers
   virtual bool EventHandler(Event /*unused*/) { return false; }  // NOLINT
 
+  // Mouse events are sent to the children drawn below the mouse, found by a
+  // binary search of their boxes along |axis_|. The children which received
+  // the previous event get this one too. This lets them notice the mouse
+  // leaving, or keep dragging.
   virtual bool OnMouseEvent(Event event) {
-    return ComponentBase::OnEvent(std::move(event));
+    if (axis_ == Axis::None || boxes_count_ != children_.size()) {
+      return ComponentBase::OnEvent(std::move(event));
+    }
+
+    std::vector<size_t> hits = MouseHits(event.mouse().x, event.mouse().y);
+    std::vector<size_t> targets;
+    std::set_union(hits.begin(), hits.end(), mouse_targets_.begin(),
+                   mouse_targets_.end(), std::back_inserter(targets));
+
+    bool handled = false;
+    for (size_t i : targets) {
+      if (i < children_.size() && children_[i]->OnEvent(event)) {
+        children_[i]->Invalidate();
+        hits.push_back(i);
+        handled = true;
+        break;
+      }
+    }
+
+    std::sort(hits.begin(), hits.end());
+    hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+    mouse_targets_ = std::move(hits);
+    return handled;
+  }
+
+  // Wrap the Element of the |i|-th child, to record where it is drawn.
+  Element ReflectChild(size_t i, Element element) {
+    while (boxes_.size() <= i) {
+      boxes_.emplace_back();
+    }
+    boxes_count_ = std::max(boxes_count_, i + 1);
+    return element | reflect(boxes_[i]);
   }
 
+  // Start recording the boxes of the children from the first one.
+  void ResetChildBoxes() { boxes_count_ = 0; }
+
+  // The axis the children are drawn along, or None when they aren't indexed.
+  enum class Axis { None, X, Y };
+  Axis axis_ = Axis::None;
+
   int selected_ = 0;
   int* selector_ = nullptr;
 
   void MoveSelector(int dir) {
     for (int i = *selector_ + dir; i >= 0 && i < (int)children_.size();
          i += dir) {
-      if (children_[i]->Focusable()) {
+      if (children_[i]->FocusableCached()) {
         *selector_ = i;
         return;
       }
@@ -84,22 +132,52 @@ class ContainerBase : public ComponentBase {
     for (size_t offset = 1; offset < children_.size(); ++offset) {
       size_t i = ((size_t(*selector_ + offset * dir + children_.size())) %
                   children_.size());
-      if (children_[i]->Focusable()) {
+      if (children_[i]->FocusableCached()) {
         *selector_ = (int)i;
         return;
       }
     }
   }
+
+ private:
+  // The indices of the children whose box contains (x,y), in order.
+  std::vector<size_t> MouseHits(int x, int y) const {
+    const bool vertical = axis_ == Axis::Y;
+    const int position = vertical ? y : x;
+    const auto begin = boxes_.begin();
+    const auto end = boxes_.begin() + std::ptrdiff_t(boxes_count_);
+    auto it = std::partition_point(begin, end, [&](const Box& box) {
+      return (vertical ? box.y_max : box.x_max) < position;
+    });
+
+    std::vector<size_t> hits;
+    for (; it != end && (vertical ? it->y_min : it->x_min) <= position; ++it) {
+      if (it->Contain(x, y)) {
+        hits.push_back(size_t(it - begin));
+      }
+    }
+    return hits;
+  }
+
+  // The children's boxes. A deque keeps the references given to reflect()
+  // valid when it grows.
+  std::deque<Box> boxes_;
+  size_t boxes_count_ = 0;
+  std::vector<size_t> mouse_targets_;
 };
 
 class VerticalContainer : public ContainerBase {
  public:
-  using ContainerBase::ContainerBase;
+  VerticalContainer(Components children, int* selector)
+      : ContainerBase(std::move(children), selector) {
+    axis_ = Axis::Y;
+  }
 
   Element Render() override {
     Elements elements;
-    for (auto& it : children_) {
-      elements.push_back(it->Render());
+    ResetChildBoxes();
+    for (size_t i = 0; i < children_.size(); ++i) {
+      elements.push_back(ReflectChild(i, children_[i]->RenderCached()));
     }
     if (elements.empty()) {
       return text("Empty container") | reflect(box_);
@@ -176,12 +254,16 @@ class VerticalContainer : public ContainerBase {
 
 class HorizontalContainer : public ContainerBase {
  public:
-  using ContainerBase::ContainerBase;
+  HorizontalContainer(Components children, int* selector)
+      : ContainerBase(std::move(children), selector) {
+    axis_ = Axis::X;
+  }
 
   Element Render() override {
     Elements elements;
-    for (auto& it : children_) {
-      elements.push_back(it->Render());
+    ResetChildBoxes();
+    for (size_t i = 0; i < children_.size(); ++i) {
+      elements.push_back(ReflectChild(i, children_[i]->RenderCached()));
     }
     if (elements.empty()) {
       return text("Empty container");
@@ -216,7 +298,7 @@ class TabContainer : public ContainerBase {
   Element Render() override {
     Component active_child = ActiveChild();
     if (active_child) {
-      return active_child->Render();
+      return active_child->RenderCached();
     }
     return text("Empty container");
   }
@@ -225,11 +307,16 @@ class TabContainer : public ContainerBase {
     if (children_.empty()) {
       return false;
     }
-    return children_[*selector_ % children_.size()]->Focusable();
+    return children_[*selector_ % children_.size()]->FocusableCached();
   }
 
   bool OnMouseEvent(Event event) override {
-    return ActiveChild()->OnEvent(event);
+    Component active_child = ActiveChild();
+    if (active_child->OnEvent(event)) {
+      active_child->Invalidate();
+      return true;
+    }
+    return false;
   }
 };
 
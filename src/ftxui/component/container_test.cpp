@@ -1,9 +1,14 @@
 #include <gtest/gtest.h>
 #include <memory>  // for __shared_ptr_access, shared_ptr, allocator
+#include <vector>  // for vector
 
 #include "ftxui/component/component.hpp"  // for Horizontal, Vertical, Button, Tab
 #include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
 #include "ftxui/component/event.hpp"  // for Event, Event::Tab, Event::TabReverse, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::None, Mouse::Released
+#include "ftxui/dom/elements.hpp"     // for text
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/screen.hpp"    // for Screen
 
 namespace ftxui {
 
@@ -14,6 +19,17 @@ Component Focusable() {
 Component NonFocusable() {
   return Container::Horizontal({});
 }
+Event MouseMoved(int x, int y) {
+  Mouse mouse;
+  mouse.button = Mouse::None;
+  mouse.motion = Mouse::Released;
+  mouse.shift = false;
+  mouse.meta = false;
+  mouse.control = false;
+  mouse.x = x;
+  mouse.y = y;
+  return Event::Mouse("", mouse);
+}
 }  // namespace
 
 TEST(ContainerTest, HorizontalEvent) {
@@ -332,6 +348,74 @@ TEST(ContainerTest, TabFocusable) {
   EXPECT_FALSE(c->Focused());
 }
 
+TEST(ContainerTest, MouseIndex) {
+  std::vector<int> received(1000, 0);
+  Components children;
+  for (int i = 0; i < 1000; ++i) {
+    children.push_back(CatchEvent(Renderer([] { return text("x"); }),
+                                  [&received, i](const Event& /*event*/) {
+                                    received[i]++;
+                                    return i == 700;
+                                  }));
+  }
+  auto container = Container::Vertical(children);
+  Screen screen(1, 1000);
+  Render(screen, container->Render());
+
+  // Only the child below the mouse receives it.
+  EXPECT_FALSE(container->OnEvent(MouseMoved(0, 500)));
+  EXPECT_EQ(received[500], 1);
+
+  // The previous one is told the mouse left.
+  EXPECT_TRUE(container->OnEvent(MouseMoved(0, 700)));
+  EXPECT_EQ(received[500], 2);
+  EXPECT_EQ(received[700], 1);
+
+  // The one handling the event keeps receiving them, like when dragging.
+  EXPECT_TRUE(container->OnEvent(MouseMoved(0, 10)));
+  EXPECT_EQ(received[10], 1);
+  EXPECT_EQ(received[700], 2);
+
+  int total = 0;
+  for (int count : received) {
+    total += count;
+  }
+  EXPECT_EQ(total, 5);
+}
+
+TEST(ContainerTest, FocusedPath) {
+  class Leaf : public ComponentBase {
+   public:
+    explicit Leaf(int* focusable_calls) : focusable_calls_(focusable_calls) {}
+    bool Focusable() const override {
+      (*focusable_calls_)++;
+      return true;
+    }
+    bool OnEvent(Event event) override {
+      received++;
+      return event == Event::Return;
+    }
+    int received = 0;
+
+   private:
+    int* focusable_calls_;
+  };
+
+  int focusable_calls = 0;
+  auto leaf = std::make_shared<Leaf>(&focusable_calls);
+  Component component = leaf;
+  for (int i = 0; i < 20; ++i) {
+    component = Container::Vertical({component, Focusable()});
+  }
+
+  EXPECT_TRUE(component->OnEvent(Event::Return));
+  EXPECT_EQ(leaf->received, 1);
+
+  // The focusable status of the leaf is computed once for the root, and once
+  // when dispatching the event along the focused path.
+  EXPECT_EQ(focusable_calls, 2);
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
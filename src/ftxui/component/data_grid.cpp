@@ -0,0 +1,263 @@
+#include <algorithm>   // for max, min
+#include <cstdint>     // for int64_t
+#include <functional>  // for function
+#include <memory>      // for shared_ptr, allocator
+#include <string>      // for string
+#include <utility>     // for move
+#include <vector>      // for vector
+
+#include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse
+#include "ftxui/component/component.hpp"       // for Make, DataGrid
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for DataGridOption
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::End, Event::Home, Event::PageDown, Event::PageUp, Event::Return
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Released, Mouse::WheelDown, Mouse::WheelUp, Mouse::None
+#include "ftxui/dom/elements.hpp"  // for operator|, Element, text, hbox, vbox, separator, size, bold, inverted, reflect, EQUAL, WIDTH
+#include "ftxui/dom/node.hpp"      // for Node
+#include "ftxui/screen/box.hpp"    // for Box
+#include "ftxui/screen/string.hpp"  // for string_width
+#include "ftxui/screen/terminal.hpp"  // for Size
+#include "ftxui/screen/util.hpp"      // for clamp
+#include "ftxui/util/ref.hpp"         // for Ref
+
+namespace ftxui {
+
+namespace {
+
+class DataGridBase : public ComponentBase {
+ public:
+  DataGridBase(int* selected, Ref<DataGridOption> option)
+      : selected_(selected), option_(std::move(option)) {}
+
+  Element Render() override {
+    const int rows = Rows();
+    Clamp(rows);
+    if (widths_.size() != option_->header.size()) {
+      SampleWidths(rows);
+    }
+
+    // Keep the selected row visible.
+    const int height = VisibleRows();
+    scroll_ = std::min(scroll_, *selected_);
+    scroll_ = std::max(scroll_, *selected_ - height + 1);
+    scroll_ = util::clamp(scroll_, 0, std::max(0, rows - height));
+
+    // Only the visible rows are materialized. The columns widen to fit them.
+    const int visible = std::min(height, rows - scroll_);
+    std::vector<Elements> cells(visible);
+    for (int i = 0; i < visible; ++i) {
+      for (int column = 0; column < (int)widths_.size(); ++column) {
+        cells[i].push_back(Cell(scroll_ + i, column));
+      }
+    }
+
+    Elements header;
+    for (const auto& title : option_->header) {
+      header.push_back(text(title) | bold);
+    }
+
+    Elements lines;
+    lines.push_back(Line(std::move(header)));
+    lines.push_back(separator());
+    boxes_.resize(visible);
+    const bool is_focused = Focused();
+    for (int i = 0; i < visible; ++i) {
+      Element line = Line(std::move(cells[i])) | reflect(boxes_[i]);
+      if (scroll_ + i == *selected_) {
+        line |= is_focused ? inverted : bold;
+      }
+      lines.push_back(std::move(line));
+    }
+    return vbox(std::move(lines)) | reflect(box_);
+  }
+
+  bool OnEvent(Event event) override {
+    const int rows = Rows();
+    Clamp(rows);
+    if (!CaptureMouse(event)) {
+      return false;
+    }
+
+    if (event.is_mouse()) {
+      return OnMouseEvent(event, rows);
+    }
+
+    if (!Focused()) {
+      return false;
+    }
+
+    const int old_selected = *selected_;
+    if (event == Event::ArrowUp || event == Event::Character('k')) {
+      (*selected_)--;
+    }
+    if (event == Event::ArrowDown || event == Event::Character('j')) {
+      (*selected_)++;
+    }
+    if (event == Event::PageUp) {
+      (*selected_) -= VisibleRows();
+    }
+    if (event == Event::PageDown) {
+      (*selected_) += VisibleRows();
+    }
+    if (event == Event::Home) {
+      (*selected_) = 0;
+    }
+    if (event == Event::End) {
+      (*selected_) = rows - 1;
+    }
+    Clamp(rows);
+
+    if (*selected_ != old_selected) {
+      OnChange();
+      return true;
+    }
+
+    if (event == Event::Return) {
+      if (option_->on_enter) {
+        option_->on_enter();
+      }
+      return true;
+    }
+
+    return false;
+  }
+
+ private:
+  bool OnMouseEvent(Event event, int rows) {
+    if (!box_.Contain(event.mouse().x, event.mouse().y)) {
+      return false;
+    }
+
+    const int old_selected = *selected_;
+    if (event.mouse().button == Mouse::WheelUp) {
+      (*selected_)--;
+    }
+    if (event.mouse().button == Mouse::WheelDown) {
+      (*selected_)++;
+    }
+    if (event.mouse().button == Mouse::Left &&
+        event.mouse().motion == Mouse::Released) {
+      TakeFocus();
+      for (int i = 0; i < (int)boxes_.size(); ++i) {
+        if (boxes_[i].Contain(event.mouse().x, event.mouse().y)) {
+          *selected_ = scroll_ + i;
+        }
+      }
+    }
+    Clamp(rows);
+
+    if (*selected_ != old_selected) {
+      OnChange();
+    }
+    return true;
+  }
+
+  void OnChange() {
+    if (option_->on_change) {
+      option_->on_change();
+    }
+  }
+
+  int Rows() { return option_->rows ? std::max(0, option_->rows()) : 0; }
+
+  void Clamp(int rows) {
+    *selected_ = std::max(0, util::clamp(*selected_, 0, rows - 1));
+  }
+
+  // The number of rows fitting below the header, according to the previous
+  // frame. Before the first frame, the terminal's height is used instead.
+  int VisibleRows() const {
+    const int height = box_.y_max - box_.y_min + 1 - 2;
+    return height >= 1 ? height : std::max(1, Terminal::Size().dimy);
+  }
+
+  // Materialize a cell and widen its column to fit it.
+  Element Cell(int row, int column) {
+    Element element = option_->cell_element
+                          ? option_->cell_element(row, column)
+                      : option_->cell ? text(option_->cell(row, column))
+                                      : text("");
+    element->ComputeRequirement();
+    widths_[column] = std::max(widths_[column], element->requirement().min_x);
+    return element;
+  }
+
+  // Estimate the width of the columns from the header and from rows evenly
+  // spread over the whole grid.
+  void SampleWidths(int rows) {
+    widths_.clear();
+    for (const auto& title : option_->header) {
+      widths_.push_back(string_width(title));
+    }
+    const int sample = std::min(std::max(option_->width_sample, 0), rows);
+    for (int i = 0; i < sample; ++i) {
+      const int row = int(int64_t(i) * rows / sample);
+      for (int column = 0; column < (int)widths_.size(); ++column) {
+        Cell(row, column);
+      }
+    }
+  }
+
+  Element Line(Elements cells) {
+    Elements line;
+    for (int column = 0; column < (int)cells.size(); ++column) {
+      if (column != 0) {
+        line.push_back(text(" "));
+      }
+      line.push_back(std::move(cells[column]) |
+                     size(WIDTH, EQUAL, widths_[column]));
+    }
+    return hbox(std::move(line));
+  }
+
+  bool Focusable() const final { return true; }
+
+  int* selected_;
+  Ref<DataGridOption> option_;
+  std::vector<int> widths_;
+  int scroll_ = 0;
+  Box box_;
+  std::vector<Box> boxes_;
+};
+
+}  // namespace
+
+/// @brief A scrollable grid, pulling its cells from a callback. Only the
+/// visible rows are materialized, so it can display millions of rows.
+/// @param selected The index of the selected row.
+/// @param option The header, the number of rows and the cell provider.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::TerminalOutput();
+/// int selected = 0;
+/// DataGridOption option;
+/// option.header = {"id", "name"};
+/// option.rows = [] { return 1000000; };
+/// option.cell = [](int row, int column) {
+///   return column == 0 ? std::to_string(row) : "item";
+/// };
+/// auto grid = DataGrid(&selected, option);
+/// screen.Loop(grid);
+/// ```
+///
+/// ### Output
+///
+/// ```bash
+/// id     name
+/// ────────────
+/// 0      item
+/// 1      item
+/// 2      item
+/// ```
+Component DataGrid(int* selected, Ref<DataGridOption> option) {
+  return Make<DataGridBase>(selected, std::move(option));
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
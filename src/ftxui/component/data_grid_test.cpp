@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <memory>  // for __shared_ptr_access, shared_ptr, allocator
+#include <string>  // for string, to_string
+
+#include "ftxui/component/component.hpp"       // for DataGrid
+#include "ftxui/component/component_base.hpp"  // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for DataGridOption
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::End, Event::Home
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+
+std::string Line(Screen& screen, int y) {
+  std::string line;
+  for (int x = 0; x < screen.dimx(); ++x) {
+    line += screen.PixelAt(x, y).character;
+  }
+  return line;
+}
+
+}  // namespace
+
+TEST(DataGridTest, OnlyVisibleRowsAreMaterialized) {
+  int calls = 0;
+  DataGridOption option;
+  option.header = {"id", "value"};
+  option.rows = [] { return 1000000; };
+  option.cell = [&](int row, int column) {
+    calls++;
+    return std::to_string(column == 0 ? row : 2 * row);
+  };
+  option.width_sample = 10;
+  int selected = 0;
+  auto grid = DataGrid(&selected, option);
+
+  Screen screen(20, 5);
+  Render(screen, grid->Render());
+  // The sample, and the rows fitting the terminal.
+  EXPECT_LE(calls, 2 * 10 + 2 * 1000);
+  EXPECT_EQ(Line(screen, 0), "id     value        ");
+  EXPECT_EQ(Line(screen, 1), "────────────────────");
+  EXPECT_EQ(Line(screen, 2), "0      0            ");
+  EXPECT_EQ(Line(screen, 4), "2      4            ");
+
+  // Once the height is known, only the visible rows are materialized.
+  calls = 0;
+  Render(screen, grid->Render());
+  EXPECT_EQ(calls, 2 * 3);
+}
+
+TEST(DataGridTest, Navigation) {
+  DataGridOption option;
+  option.header = {"id"};
+  option.rows = [] { return 100; };
+  option.cell = [](int row, int /* column */) { return std::to_string(row); };
+  int selected = 0;
+  int changes = 0;
+  option.on_change = [&] { changes++; };
+  auto grid = DataGrid(&selected, option);
+
+  Screen screen(4, 5);
+  Render(screen, grid->Render());
+
+  EXPECT_TRUE(grid->OnEvent(Event::ArrowDown));
+  EXPECT_EQ(selected, 1);
+  EXPECT_TRUE(grid->OnEvent(Event::PageDown));
+  EXPECT_EQ(selected, 4);
+  Render(screen, grid->Render());
+  // The header stays, the rows scrolled.
+  EXPECT_EQ(Line(screen, 0), "id  ");
+  EXPECT_EQ(Line(screen, 2), "2   ");
+  EXPECT_EQ(Line(screen, 4), "4   ");
+
+  EXPECT_TRUE(grid->OnEvent(Event::End));
+  EXPECT_EQ(selected, 99);
+  Render(screen, grid->Render());
+  EXPECT_EQ(Line(screen, 4), "99  ");
+
+  EXPECT_FALSE(grid->OnEvent(Event::ArrowDown));
+  EXPECT_TRUE(grid->OnEvent(Event::Home));
+  EXPECT_EQ(selected, 0);
+  EXPECT_EQ(changes, 4);
+}
+
+TEST(DataGridTest, ColumnsWiden) {
+  DataGridOption option;
+  option.header = {"a", "b"};
+  option.rows = [] { return 1000; };
+  option.cell = [](int row, int /* column */) {
+    return row == 500 ? "wide" : "x";
+  };
+  option.width_sample = 1;
+  int selected = 0;
+  auto grid = DataGrid(&selected, option);
+
+  Screen screen(8, 4);
+  Render(screen, grid->Render());
+  Render(screen, grid->Render());
+  EXPECT_EQ(Line(screen, 2), "x x     ");
+
+  selected = 500;
+  Render(screen, grid->Render());
+  EXPECT_EQ(Line(screen, 3), "wide wid");
+}
+
+TEST(DataGridTest, Empty) {
+  DataGridOption option;
+  option.header = {"a"};
+  int selected = 3;
+  auto grid = DataGrid(&selected, option);
+  Screen screen(4, 3);
+  Render(screen, grid->Render());
+  EXPECT_EQ(selected, 0);
+  EXPECT_EQ(Line(screen, 0), "a   ");
+  EXPECT_FALSE(grid->OnEvent(Event::ArrowDown));
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
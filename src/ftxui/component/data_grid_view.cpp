@@ -0,0 +1,160 @@
+#include "ftxui/component/data_grid_view.hpp"
+
+#include <algorithm>  // for max, sort, inplace_merge
+#include <numeric>    // for iota
+#include <utility>    // for move
+
+#include "ftxui/component/component_options.hpp"  // for DataGridOption
+#include "ftxui/dom/elements.hpp"                 // for Element, text
+
+namespace ftxui {
+
+/// @brief Constructor.
+/// @param rows The number of rows of the source.
+/// @param cell The content of a cell of the source.
+DataGridView::DataGridView(Rows rows, Cell cell)
+    : rows_(std::move(rows)), cell_(std::move(cell)) {}
+
+/// @brief Sort the rows by the text of a column.
+void DataGridView::Sort(int column, bool ascending) {
+  less_ = nullptr;
+  sort_column_ = column;
+  ascending_ = ascending;
+  Rebuild();
+}
+
+/// @brief Sort the rows with a comparison of the source rows.
+void DataGridView::Sort(Less less) {
+  less_ = std::move(less);
+  sort_column_ = -1;
+  Rebuild();
+}
+
+/// @brief Display the rows in the order of the source.
+void DataGridView::Unsort() {
+  less_ = nullptr;
+  sort_column_ = -1;
+  Rebuild();
+}
+
+/// @brief Display only the source rows satisfying |keep|. The rows aren't
+/// sorted again.
+void DataGridView::Filter(Keep keep) {
+  keep_ = std::move(keep);
+  Update();
+  index_.clear();
+  for (int row : order_) {
+    if (!keep_ || keep_(row)) {
+      index_.push_back(row);
+    }
+  }
+}
+
+int DataGridView::Size() {
+  Update();
+  return (int)index_.size();
+}
+
+int DataGridView::Source(int row) {
+  Update();
+  return index_[row];
+}
+
+std::string DataGridView::Get(int row, int column) {
+  return cell_(Source(row), column);
+}
+
+/// @brief Make the DataGrid using |option| display this view.
+void DataGridView::Bind(DataGridOption* option) {
+  option->rows = [this] { return Size(); };
+  option->cell = [this](int row, int column) { return Get(row, column); };
+  if (option->cell_element) {
+    cell_element_ = std::move(option->cell_element);
+  }
+  option->cell_element = [this](int row, int column) {
+    return cell_element_ ? cell_element_(Source(row), column)
+                         : text(Get(row, column));
+  };
+}
+
+/// @brief Draw the cells of the bound DataGrid with |cell_element|, called
+/// with the source rows. nullptr draws their text.
+void DataGridView::SetCellElement(CellElement cell_element) {
+  cell_element_ = std::move(cell_element);
+}
+
+// A strict total order: equal rows are ordered by their source position.
+bool DataGridView::Before(int a, int b) const {
+  if (sort_column_ >= 0) {
+    const int compare = keys_[a].compare(keys_[b]);
+    if (compare != 0) {
+      return ascending_ ? compare < 0 : compare > 0;
+    }
+  } else if (less_) {
+    if (less_(a, b)) {
+      return true;
+    }
+    if (less_(b, a)) {
+      return false;
+    }
+  }
+  return a < b;
+}
+
+// Sort and filter every row again.
+void DataGridView::Rebuild() {
+  source_size_ = 0;
+  keys_.clear();
+  order_.clear();
+  index_.clear();
+  Update();
+}
+
+// Sort and filter the rows appended to the source, and merge them.
+void DataGridView::Update() {
+  const int size = std::max(0, rows_());
+  if (size < source_size_) {
+    Rebuild();
+    return;
+  }
+  if (size == source_size_) {
+    return;
+  }
+
+  std::vector<int> added(size - source_size_);
+  std::iota(added.begin(), added.end(), source_size_);
+  source_size_ = size;
+
+  if (sort_column_ >= 0) {
+    for (int row : added) {
+      keys_.push_back(cell_(row, sort_column_));
+    }
+  }
+  const bool sorted = sort_column_ >= 0 || less_;
+  auto before = [this](int a, int b) { return Before(a, b); };
+  if (sorted) {
+    std::sort(added.begin(), added.end(), before);
+  }
+
+  auto merge = [&](std::vector<int>& out, const std::vector<int>& rows) {
+    const size_t middle = out.size();
+    out.insert(out.end(), rows.begin(), rows.end());
+    if (sorted) {
+      std::inplace_merge(out.begin(), out.begin() + middle, out.end(), before);
+    }
+  };
+
+  merge(order_, added);
+  if (keep_) {
+    added.erase(std::remove_if(added.begin(), added.end(),
+                               [&](int row) { return !keep_(row); }),
+                added.end());
+  }
+  merge(index_, added);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
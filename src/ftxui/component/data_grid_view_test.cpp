@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+#include <vector>  // for vector
+
+#include "ftxui/component/component_options.hpp"  // for DataGridOption
+#include "ftxui/component/data_grid_view.hpp"
+#include "ftxui/dom/elements.hpp"   // for text
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+
+std::vector<int> Rows(DataGridView& view) {
+  std::vector<int> rows;
+  for (int i = 0; i < view.Size(); ++i) {
+    rows.push_back(view.Source(i));
+  }
+  return rows;
+}
+
+std::string Print(const Element& element) {
+  Screen screen(3, 1);
+  Render(screen, element);
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(DataGridViewTest, Sort) {
+  std::vector<std::string> data = {"b", "c", "a", "b"};
+  DataGridView view([&] { return (int)data.size(); },
+                    [&](int row, int /* column */) { return data[row]; });
+  EXPECT_EQ(Rows(view), std::vector<int>({0, 1, 2, 3}));
+
+  view.Sort(0);
+  EXPECT_EQ(Rows(view), std::vector<int>({2, 0, 3, 1}));
+  EXPECT_EQ(view.Get(0, 0), "a");
+
+  view.Sort(0, /*ascending=*/false);
+  EXPECT_EQ(Rows(view), std::vector<int>({1, 0, 3, 2}));
+
+  view.Sort([](int a, int b) { return a % 2 < b % 2; });
+  EXPECT_EQ(Rows(view), std::vector<int>({0, 2, 1, 3}));
+
+  view.Unsort();
+  EXPECT_EQ(Rows(view), std::vector<int>({0, 1, 2, 3}));
+}
+
+TEST(DataGridViewTest, Filter) {
+  std::vector<std::string> data = {"b", "c", "a", "b"};
+  DataGridView view([&] { return (int)data.size(); },
+                    [&](int row, int /* column */) { return data[row]; });
+  view.Sort(0);
+  view.Filter([&](int row) { return data[row] != "b"; });
+  EXPECT_EQ(Rows(view), std::vector<int>({2, 1}));
+  view.Filter(nullptr);
+  EXPECT_EQ(Rows(view), std::vector<int>({2, 0, 3, 1}));
+}
+
+TEST(DataGridViewTest, Append) {
+  std::vector<std::string> data = {"d", "b"};
+  int calls = 0;
+  DataGridView view([&] { return (int)data.size(); },
+                    [&](int row, int /* column */) {
+                      calls++;
+                      return data[row];
+                    });
+  view.Sort(0);
+  view.Filter([&](int row) { return data[row] != "c"; });
+  EXPECT_EQ(Rows(view), std::vector<int>({1, 0}));
+  EXPECT_EQ(calls, 2);
+
+  // Only the new rows are read.
+  data.push_back("a");
+  data.push_back("c");
+  data.push_back("b");
+  EXPECT_EQ(Rows(view), std::vector<int>({2, 1, 4, 0}));
+  EXPECT_EQ(calls, 5);
+}
+
+TEST(DataGridViewTest, Bind) {
+  std::vector<std::string> data = {"b", "a"};
+  DataGridView view([&] { return (int)data.size(); },
+                    [&](int row, int /* column */) { return data[row]; });
+  view.Sort(0);
+  DataGridOption option;
+  view.Bind(&option);
+  EXPECT_EQ(option.rows(), 2);
+  EXPECT_EQ(option.cell(0, 0), "a");
+  EXPECT_EQ(option.cell(1, 0), "b");
+  EXPECT_EQ(Print(option.cell_element(0, 0)), "a  ");
+}
+
+TEST(DataGridViewTest, BindCellElement) {
+  std::vector<std::string> data = {"b", "a"};
+  DataGridView view([&] { return (int)data.size(); },
+                    [&](int row, int /* column */) { return data[row]; });
+  view.Sort(0);
+  DataGridOption option;
+  option.cell_element = [&](int row, int /* column */) {
+    return text(std::to_string(row));
+  };
+  view.Bind(&option);
+  EXPECT_EQ(Print(option.cell_element(0, 0)), "1  ");
+
+  // Set after Bind().
+  view.SetCellElement([&](int row, int /* column */) {
+    return text(data[row] + std::to_string(row));
+  });
+  EXPECT_EQ(Print(option.cell_element(0, 0)), "a1 ");
+  EXPECT_EQ(Print(option.cell_element(1, 0)), "b0 ");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
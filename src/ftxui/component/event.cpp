@@ -1,4 +1,5 @@
-#include <utility>  // for move
+#include <algorithm>  // for copy, equal
+#include <memory>     // for make_shared
 
 #include "ftxui/component/event.hpp"
 #include "ftxui/component/mouse.hpp"  // for Mouse
@@ -6,17 +7,66 @@
 
 namespace ftxui {
 
+namespace {
+
+uint64_t Key(const char* data, size_t size) {
+  uint64_t key = 0;
+  if (size < sizeof(key)) {
+    for (size_t i = 0; i < size; ++i) {
+      key |= uint64_t(uint8_t(data[i])) << (8U * i);  // NOLINT
+    }
+    return key | uint64_t(size) << 56U;  // NOLINT
+  }
+
+  // FNV-1a. The last byte is 0xFF, which no short input has.
+  key = 14695981039346656037ULL;  // NOLINT
+  for (size_t i = 0; i < size; ++i) {
+    key ^= uint8_t(data[i]);  // NOLINT
+    key *= 1099511628211ULL;  // NOLINT
+  }
+  return key | uint64_t(0xFF) << 56U;  // NOLINT
+}
+
+}  // namespace
+
+void Event::SetInput(const char* data, size_t size) {
+  key_ = Key(data, size);
+  size_ = size;
+  if (size <= kInlineSize) {
+    std::copy(data, data + size, inline_);  // NOLINT
+    heap_.reset();
+  } else {
+    heap_ = std::make_shared<const std::string>(data, size);
+  }
+}
+
+const char* Event::data() const {
+  return heap_ ? heap_->data() : inline_;  // NOLINT
+}
+
+bool Event::SameInput(const Event& other) const {
+  return size_ == other.size_ &&
+         std::equal(data(), data() + size_, other.data());  // NOLINT
+}
+
+std::string Event::input() const {
+  return {data(), size_};
+}
+
 // static
 Event Event::Character(std::string input) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(input.data(), input.size());
   event.type_ = Type::Character;
   return event;
 }
 
 // static
 Event Event::Character(char c) {
-  return Event::Character(std::string{c});
+  Event event;
+  event.SetInput(&c, 1);
+  event.type_ = Type::Character;
+  return event;
 }
 
 // static
@@ -27,7 +77,7 @@ Event Event::Character(wchar_t c) {
 // static
 Event Event::Mouse(std::string input, struct Mouse mouse) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(input.data(), input.size());
   event.type_ = Type::Mouse;
   event.mouse_ = mouse;  // NOLINT
   return event;
@@ -36,14 +86,14 @@ Event Event::Mouse(std::string input, struct Mouse mouse) {
 // static
 Event Event::Special(std::string input) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(input.data(), input.size());
   return event;
 }
 
 // static
 Event Event::CursorReporting(std::string input, int x, int y) {
   Event event;
-  event.input_ = std::move(input);
+  event.SetInput(input.data(), input.size());
   event.type_ = Type::CursorReporting;
   event.cursor_.x = x;  // NOLINT
   event.cursor_.y = y;  // NOLINT
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/component/event.hpp"  // for Event
+
+namespace ftxui {
+
+TEST(EventTest, Equality) {
+  EXPECT_EQ(Event::ArrowDown, Event::Special("\x1B[B"));
+  EXPECT_NE(Event::ArrowDown, Event::ArrowUp);
+  EXPECT_EQ(Event::Character('a'), Event::Character("a"));
+  EXPECT_EQ(Event::Character(L'a'), Event::Character("a"));
+  EXPECT_NE(Event::Character('a'), Event::Character("ab"));
+  EXPECT_NE(Event::Character("a"), Event::Character(std::string{'a', '\0'}));
+  EXPECT_EQ(Event::Custom, Event::Special({0}));
+  EXPECT_NE(Event::Custom, Event());
+}
+
+TEST(EventTest, LongInput) {
+  const std::string a = "\x1B[<0;1000;1000M and some more bytes";
+  const std::string b = "\x1B[<0;1000;1000M and some more bytez";
+  EXPECT_EQ(Event::Special(a), Event::Special(a));
+  EXPECT_NE(Event::Special(a), Event::Special(b));
+  EXPECT_EQ(Event::Special(a).input(), a);
+}
+
+TEST(EventTest, Input) {
+  EXPECT_EQ(Event::Character("é").character(), "é");
+  EXPECT_EQ(Event::Character('a').input(), "a");
+  EXPECT_EQ(Event::PageUp.input(), "\x1B[5~");
+  EXPECT_EQ(Event().input(), "");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
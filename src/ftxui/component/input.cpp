@@ -184,8 +184,12 @@ class InputBase : public ComponentBase {
 
  private:
   bool OnMouseEvent(Event event) {
-    hovered_ =
+    const bool hovered =
         box_.Contain(event.mouse().x, event.mouse().y) && CaptureMouse(event);
+    if (hovered_ != hovered) {
+      hovered_ = hovered;
+      Invalidate();
+    }
     if (!hovered_) {
       return false;
     }
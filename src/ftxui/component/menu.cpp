@@ -302,7 +302,10 @@ class MenuBase : public ComponentBase {
       }
 
       TakeFocus();
-      focused_entry() = i;
+      if (focused_entry() != i) {
+        focused_entry() = i;
+        Invalidate();
+      }
       if (event.mouse().button == Mouse::Left &&
           event.mouse().motion == Mouse::Released) {
         if (*selected_ != i) {
@@ -600,7 +603,11 @@ Component MenuEntry(ConstStringRef label, Ref<MenuEntryOption> option) {
         return false;
       }
 
-      hovered_ = box_.Contain(event.mouse().x, event.mouse().y);
+      const bool hovered = box_.Contain(event.mouse().x, event.mouse().y);
+      if (hovered_ != hovered) {
+        hovered_ = hovered;
+        Invalidate();
+      }
 
       if (!hovered_) {
         return false;
@@ -26,11 +26,11 @@ Component Modal(Component main, Component modal, const bool* show_modal) {
    private:
     Element Render() override {
       selector_ = *show_modal_;
-      auto document = main_->Render();
+      auto document = main_->RenderCached();
       if (*show_modal_) {
         document = dbox({
             document,
-            modal_->Render() | clear_under | center,
+            modal_->RenderCached() | clear_under | center,
         });
       }
       return document;
@@ -125,7 +125,10 @@ class RadioboxBase : public ComponentBase {
       }
 
       TakeFocus();
-      focused_entry() = i;
+      if (focused_entry() != i) {
+        focused_entry() = i;
+        Invalidate();
+      }
       if (event.mouse().button == Mouse::Left &&
           event.mouse().motion == Mouse::Released) {
         if (*selected_ != i) {
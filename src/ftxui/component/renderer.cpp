@@ -124,7 +124,7 @@ Component Renderer(std::function<Element(bool)> render) {
 ComponentDecorator Renderer(ElementDecorator decorator) {  // NOLINT
   return [decorator](Component component) {                // NOLINT
     return Renderer(component, [component, decorator] {
-      return component->Render() | decorator;
+      return component->RenderCached() | decorator;
     });
   };
 }
@@ -55,9 +55,9 @@ class ResizableSplitLeftBase : public ComponentBase {
 
   Element Render() final {
     return hbox({
-               main_->Render() | size(WIDTH, EQUAL, *main_size_),
+               main_->RenderCached() | size(WIDTH, EQUAL, *main_size_),
                separator() | reflect(separator_box_),
-               child_->Render() | xflex,
+               child_->RenderCached() | xflex,
            }) |
            reflect(box_);
   };
@@ -114,9 +114,9 @@ class ResizableSplitRightBase : public ComponentBase {
 
   Element Render() final {
     return hbox({
-               child_->Render() | xflex,
+               child_->RenderCached() | xflex,
                separator() | reflect(separator_box_),
-               main_->Render() | size(WIDTH, EQUAL, *main_size_),
+               main_->RenderCached() | size(WIDTH, EQUAL, *main_size_),
            }) |
            reflect(box_);
   };
@@ -173,9 +173,9 @@ class ResizableSplitTopBase : public ComponentBase {
 
   Element Render() final {
     return vbox({
-               main_->Render() | size(HEIGHT, EQUAL, *main_size_),
+               main_->RenderCached() | size(HEIGHT, EQUAL, *main_size_),
                separator() | reflect(separator_box_),
-               child_->Render() | yflex,
+               child_->RenderCached() | yflex,
            }) |
            reflect(box_);
   };
@@ -232,9 +232,9 @@ class ResizableSplitBottomBase : public ComponentBase {
 
   Element Render() final {
     return vbox({
-               child_->Render() | yflex,
+               child_->RenderCached() | yflex,
                separator() | reflect(separator_box_),
-               main_->Render() | size(HEIGHT, EQUAL, *main_size_),
+               main_->RenderCached() | size(HEIGHT, EQUAL, *main_size_),
            }) |
            reflect(box_);
   };
@@ -7,7 +7,7 @@
 #include <ftxui/screen/screen.hpp>   // for Pixel, Screen::Cursor, Screen
 #include <functional>                // for function
 #include <initializer_list>          // for initializer_list
-#include <iostream>  // for cout, ostream, basic_ostream, operator<<, endl, flush
+#include <memory>                    // for make_shared, make_unique
 #include <stack>     // for stack
 #include <thread>    // for thread, sleep_for
 #include <type_traits>  // for decay_t
@@ -24,7 +24,8 @@
 #include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
 #include "ftxui/dom/node.hpp"                         // for Node, Render
 #include "ftxui/dom/requirement.hpp"                  // for Requirement
-#include "ftxui/screen/terminal.hpp"                  // for Size, Dimensions
+#include "ftxui/screen/row_diff.hpp"                  // for DiffRows
+#include "ftxui/screen/terminal.hpp"  // for Size, Dimensions, SynchronizedOutputSupport, Write
 
 #if defined(_WIN32)
 #define DEFINE_CONSOLEV2_PROPERTIES
@@ -62,13 +63,10 @@ namespace {
 
 ScreenInteractive* g_active_screen = nullptr;  // NOLINT
 
-void Flush() {
-  // Emscripten doesn't implement flush. We interpret zero as flush.
-  std::cout << '\0' << std::flush;
-}
-
 constexpr int timeout_milliseconds = 20;
 constexpr int timeout_microseconds = timeout_milliseconds * 1000;
+// Animation at around 60fps.
+constexpr auto animation_delta = std::chrono::milliseconds(15);
 #if defined(_WIN32)
 
 void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
@@ -182,6 +180,7 @@ enum class DECMode {
   kMouseUrxvtMode = 1015,
   kMouseSgrPixelsMode = 1016,
   kAlternateScreen = 1049,
+  kSynchronizedOutput = 2026,
 };
 
 // Device Status Report (DSR) {
@@ -256,24 +255,39 @@ class CapturedMouseImpl : public CapturedMouseInterface {
 };
 
 void AnimationListener(std::atomic<bool>* quit, Sender<Task> out) {
-  // Animation at around 60fps.
-  const auto time_delta = std::chrono::milliseconds(15);
   while (!*quit) {
     out->Send(AnimationTask());
-    std::this_thread::sleep_for(time_delta);
+    std::this_thread::sleep_for(animation_delta);
   }
 }
 
 }  // namespace
 
+struct ScreenInteractive::HeadlessState {
+  std::string input;
+  size_t position = 0;
+  // The events parsed from |input|, not yet received by the screen.
+  Receiver<Task> events = MakeReceiver<Task>();
+  std::unique_ptr<TerminalInputParser> parser;
+  Terminal::Output output;
+  // The virtual clock.
+  animation::TimePoint now;
+};
+
 ScreenInteractive::ScreenInteractive(int dimx,
                                      int dimy,
                                      Dimension dimension,
-                                     bool use_alternative_screen)
+                                     bool use_alternative_screen,
+                                     std::shared_ptr<HeadlessState> headless)
     : Screen(dimx, dimy),
       dimension_(dimension),
-      use_alternative_screen_(use_alternative_screen) {
+      use_alternative_screen_(use_alternative_screen),
+      headless_(std::move(headless)) {
   task_receiver_ = MakeReceiver<Task>();
+  if (headless_) {
+    headless_->parser = std::make_unique<TerminalInputParser>(
+        headless_->events->MakeSender());
+  }
 }
 
 // static
@@ -296,6 +310,32 @@ ScreenInteractive ScreenInteractive::FitComponent() {
   return ScreenInteractive(0, 0, Dimension::FitComponent, false);
 }
 
+/// @brief A screen without terminal, to replay a recorded session as fast as
+/// possible, in tests and benchmarks.
+///
+/// `Loop` runs as usual, but doesn't touch the terminal. The events are parsed
+/// from |input|, the bytes a terminal would have sent, and the frames are
+/// written to |output|. Every step of the loop receives the next event, and
+/// moves a virtual clock forward by one animation frame (15ms), so animations
+/// are deterministic. The loop exits once |input| is consumed.
+///
+/// With |use_alternative_screen|, the frames are drawn like `Fullscreen`: only
+/// the rows modified since the previous frame are written.
+///
+/// See `stats()` for the number of frames and bytes drawn.
+// static
+ScreenInteractive ScreenInteractive::Headless(int dimx,
+                                              int dimy,
+                                              std::string input,
+                                              Terminal::Output output,
+                                              bool use_alternative_screen) {
+  auto headless = std::make_shared<HeadlessState>();
+  headless->input = std::move(input);
+  headless->output = std::move(output);
+  return ScreenInteractive(dimx, dimy, Dimension::Fixed,
+                           use_alternative_screen, std::move(headless));
+}
+
 void ScreenInteractive::Post(Task task) {
   // Task/Events sent toward inactive screen or screen waiting to become
   // inactive are dropped.
@@ -311,11 +351,12 @@ void ScreenInteractive::PostEvent(Event event) {
 }
 
 void ScreenInteractive::RequestAnimationFrame() {
+  ComponentBase::AnimationFrameRequested();
   if (animation_requested_) {
     return;
   }
   animation_requested_ = true;
-  auto now = animation::Clock::now();
+  auto now = Now();
   const auto time_histeresis = std::chrono::milliseconds(33);
   if (now - previous_animation_time >= time_histeresis) {
     previous_animation_time = now;
@@ -335,8 +376,8 @@ void ScreenInteractive::Loop(Component component) {  // NOLINT
   // Suspend previously active screen:
   if (g_active_screen) {
     std::swap(suspended_screen_, g_active_screen);
-    std::cout << suspended_screen_->reset_cursor_position
-              << suspended_screen_->ResetPosition(/*clear=*/true);
+    suspended_screen_->Write(suspended_screen_->reset_cursor_position +
+                             suspended_screen_->ResetPosition(/*clear=*/true));
     suspended_screen_->dimx_ = 0;
     suspended_screen_->dimy_ = 0;
     suspended_screen_->Uninstall();
@@ -350,11 +391,11 @@ void ScreenInteractive::Loop(Component component) {  // NOLINT
   g_active_screen = nullptr;
 
   // Put cursor position at the end of the drawing.
-  std::cout << reset_cursor_position;
+  Write(reset_cursor_position);
 
   // Restore suspended screen.
   if (suspended_screen_) {
-    std::cout << ResetPosition(/*clear=*/true);
+    Write(ResetPosition(/*clear=*/true));
     dimx_ = 0;
     dimy_ = 0;
     std::swap(g_active_screen, suspended_screen_);
@@ -362,7 +403,7 @@ void ScreenInteractive::Loop(Component component) {  // NOLINT
   } else {
     // On final exit, keep the current drawing and reset cursor position one
     // line after it.
-    std::cout << std::endl;
+    Write("\n");
   }
 }
 
@@ -383,9 +424,18 @@ ScreenInteractive* ScreenInteractive::Active() {
 }
 
 void ScreenInteractive::Install() {
-  // After uninstalling the new configuration, flush it to the terminal to
-  // ensure it is fully applied:
-  on_exit_functions.push([] { Flush(); });
+  // Entering the alternative screen clears it. The next frame can't be diffed
+  // against the previous one, and must draw every row.
+  rows_.clear();
+  previous_rows_.clear();
+
+  // A headless screen has no terminal to configure. Its events are produced
+  // by `HeadlessStep`.
+  if (headless_) {
+    quit_ = false;
+    task_sender_ = task_receiver_->MakeSender();
+    return;
+  }
 
   on_exit_functions.push([this] { ExitLoopClosure()(); });
 
@@ -450,13 +500,13 @@ void ScreenInteractive::Install() {
 #endif
 
   auto enable = [&](const std::vector<DECMode>& parameters) {
-    std::cout << Set(parameters);
-    on_exit_functions.push([=] { std::cout << Reset(parameters); });
+    Terminal::Write(Set(parameters));
+    on_exit_functions.push([=] { Terminal::Write(Reset(parameters)); });
   };
 
   auto disable = [&](const std::vector<DECMode>& parameters) {
-    std::cout << Reset(parameters);
-    on_exit_functions.push([=] { std::cout << Set(parameters); });
+    Terminal::Write(Reset(parameters));
+    on_exit_functions.push([=] { Terminal::Write(Set(parameters)); });
   };
 
   if (use_alternative_screen_) {
@@ -477,10 +527,6 @@ void ScreenInteractive::Install() {
       DECMode::kMouseSgrExtMode,
   });
 
-  // After installing the new configuration, flush it to the terminal to ensure
-  // it is fully applied:
-  Flush();
-
   quit_ = false;
   task_sender_ = task_receiver_->MakeSender();
   event_listener_ =
@@ -491,6 +537,9 @@ void ScreenInteractive::Install() {
 
 void ScreenInteractive::Uninstall() {
   ExitLoopClosure()();
+  if (headless_) {
+    return;
+  }
   event_listener_.join();
   animation_listener_.join();
 
@@ -499,12 +548,39 @@ void ScreenInteractive::Uninstall() {
 
 // NOLINTNEXTLINE
 void ScreenInteractive::Main(Component component) {
-  previous_animation_time = animation::Clock::now();
+  const animation::TimePoint start = animation::Clock::now();
+  previous_animation_time = Now();
 
+  // Every frame is sent with a single write. When the terminal supports it,
+  // the frame is wrapped into a synchronized update, so that the terminal
+  // displays it at once.
   auto draw = [&] {
+    const bool synchronized =
+        !headless_ && Terminal::SynchronizedOutputSupport();
+    frame_.clear();
+    if (synchronized) {
+      frame_ += Set({DECMode::kSynchronizedOutput});
+    }
     Draw(component);
-    std::cout << ToString() << set_cursor_position;
-    Flush();
+    if (use_alternative_screen_) {
+      // The frame covers the whole terminal. Only the rows modified since the
+      // previous frame are sent.
+      rows_.swap(previous_rows_);
+      rows_.resize(dimy_);
+      for (int y = 0; y < dimy_; ++y) {
+        rows_[y] = RowToString(y);
+      }
+      frame_ += DiffRows(previous_rows_, rows_, dimx_);
+    } else {
+      frame_ += ToString();
+    }
+    frame_ += set_cursor_position;
+    if (synchronized) {
+      frame_ += Reset({DECMode::kSynchronizedOutput});
+    }
+    Write(frame_);
+    stats_.frames++;
+    stats_.bytes += frame_.size();
     Clear();
   };
 
@@ -515,6 +591,10 @@ void ScreenInteractive::Main(Component component) {
       attempt_draw = false;
     }
 
+    if (headless_ && !task_receiver_->HasPending() && !HeadlessStep()) {
+      break;
+    }
+
     Task task;
     if (!task_receiver_->Receive(&task)) {
       break;
@@ -537,8 +617,11 @@ void ScreenInteractive::Main(Component component) {
           arg.mouse().y -= cursor_y_;
         }
 
+        stats_.events++;
         arg.screen_ = this;
-        component->OnEvent(arg);
+        if (ComponentBase::SendEvent(component, arg, /*focused=*/true)) {
+          component->Invalidate();
+        }
         attempt_draw = true;
         return;
       }
@@ -556,12 +639,13 @@ void ScreenInteractive::Main(Component component) {
         }
 
         animation_requested_ = false;
-        animation::TimePoint now = animation::Clock::now();
+        stats_.animation_frames++;
+        animation::TimePoint now = Now();
         animation::Duration delta = now - previous_animation_time;
         previous_animation_time = now;
 
         animation::Params params(delta);
-        component->OnAnimation(params);
+        ComponentBase::RunAnimation(component, params);
         attempt_draw = true;
         return;
       }
@@ -569,11 +653,13 @@ void ScreenInteractive::Main(Component component) {
     task);
     // clang-format on
   }
+
+  stats_.elapsed += animation::Clock::now() - start;
 }
 
 // NOLINTNEXTLINE
 void ScreenInteractive::Draw(Component component) {
-  auto document = component->Render();
+  auto document = component->RenderCached();
   int dimx = 0;
   int dimy = 0;
   switch (dimension_) {
@@ -599,10 +685,12 @@ void ScreenInteractive::Draw(Component component) {
   }
 
   bool resized = (dimx != dimx_) || (dimy != dimy_);
-  std::cout << reset_cursor_position << ResetPosition(/*clear=*/resized);
+  frame_ += reset_cursor_position;
+  frame_ += ResetPosition(/*clear=*/resized);
 
   // Resize the screen if needed.
   if (resized) {
+    rows_.clear();
     dimx_ = dimx;
     dimy_ = dimy;
     pixels_ = std::vector<std::vector<Pixel>>(dimy, std::vector<Pixel>(dimx));
@@ -622,15 +710,15 @@ void ScreenInteractive::Draw(Component component) {
   // https://github.com/ArthurSonzogni/FTXUI/issues/136
   static int i = -3;
   ++i;
-  if (!use_alternative_screen_ && (i % 150 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
+  if (!use_alternative_screen_ && !headless_ && (i % 150 == 0)) {  // NOLINT
+    frame_ += DeviceStatusReport(DSRMode::kCursor);
   }
 #else
   static int i = -3;
   ++i;
-  if (!use_alternative_screen_ &&
+  if (!use_alternative_screen_ && !headless_ &&
       (previous_frame_resized_ || i % 40 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
+    frame_ += DeviceStatusReport(DSRMode::kCursor);
   }
 #endif
   previous_frame_resized_ = resized;
@@ -661,18 +749,60 @@ Closure ScreenInteractive::ExitLoopClosure() {
   };
 }
 
+void ScreenInteractive::Write(const std::string& data) {
+  if (!headless_) {
+    Terminal::Write(data);
+    return;
+  }
+  if (headless_->output) {
+    headless_->output(data);
+  }
+}
+
+animation::TimePoint ScreenInteractive::Now() const {
+  return headless_ ? headless_->now : animation::Clock::now();
+}
+
+// Move the virtual clock forward by one animation frame. During this frame,
+// the requested animation is run, then the next event of the input is
+// received. Returns false once the input is consumed.
+bool ScreenInteractive::HeadlessStep() {
+  HeadlessState& state = *headless_;
+  while (!state.events->HasPending() && state.position < state.input.size()) {
+    state.parser->Add(state.input[state.position++]);
+  }
+
+  // Flush the incomplete sequence at the end of the input, like a lone escape.
+  if (!state.events->HasPending()) {
+    const int flush_milliseconds = 1000;
+    state.parser->Timeout(flush_milliseconds);
+  }
+
+  if (!state.events->HasPending()) {
+    return false;
+  }
+
+  state.now += animation_delta;
+  if (animation_requested_) {
+    task_sender_->Send(AnimationTask());
+  }
+  Task task;
+  while (state.events->HasPending() && state.events->Receive(&task)) {
+    task_sender_->Send(std::move(task));
+  }
+  return true;
+}
+
 void ScreenInteractive::SigStop() {
 #if defined(_WIN32)
   // Windows do no support SIGTSTP.
 #else
   Post([&] {
     Uninstall();
-    std::cout << reset_cursor_position;
+    Terminal::Write(reset_cursor_position + ResetPosition(/*clear=*/true));
     reset_cursor_position = "";
-    std::cout << ResetPosition(/*clear=*/true);
     dimx_ = 0;
     dimy_ = 0;
-    Flush();
     std::raise(SIGTSTP);
     Install();
   });
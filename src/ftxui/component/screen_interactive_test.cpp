@@ -1,8 +1,14 @@
 #include <gtest/gtest.h>
+#include <chrono>   // for milliseconds
 #include <csignal>  // for raise, SIGABRT, SIGFPE, SIGILL, SIGINT, SIGSEGV, SIGTERM
 #include <ftxui/component/event.hpp>  // for Event, Event::Custom
+#include <string>                     // for string
+#include <string_view>                // for string_view
+#include <vector>                     // for vector
 
-#include "ftxui/component/component.hpp"  // for Renderer
+#include "ftxui/component/animation.hpp"  // for Params, RequestAnimationFrame
+#include "ftxui/component/component.hpp"  // for Renderer, Input, Container
+#include "ftxui/component/component_base.hpp"  // for ComponentBase, Components
 #include "ftxui/component/screen_interactive.hpp"
 #include "ftxui/dom/elements.hpp"  // for text, Element
 
@@ -60,6 +66,160 @@ TEST(ScreenInteractive, PostTaskToNonActive) {
   screen.Post([] {});
 }
 
+TEST(ScreenInteractive, Headless) {
+  std::string content;
+  auto input = Input(&content, "");
+  std::string output;
+  auto screen = ScreenInteractive::Headless(
+      5, 1, "abc", [&](std::string_view data) { output += data; });
+  screen.Loop(input);
+
+  EXPECT_EQ(content, "abc");
+  EXPECT_NE(output.find("abc"), std::string::npos);
+  EXPECT_EQ(screen.stats().events, 3);
+  // The first frame, then one per event.
+  EXPECT_EQ(screen.stats().frames, 4);
+  EXPECT_EQ(screen.stats().animation_frames, 0);
+  EXPECT_GT(screen.stats().bytes, size_t(0));
+}
+
+TEST(ScreenInteractive, HeadlessAlternativeScreen) {
+  auto component = Renderer([] {
+    return vbox({
+        text("first line"),
+        text("second line"),
+        text("third line"),
+    });
+  });
+  std::vector<std::string> frames;
+  auto output = [&](std::string_view data) { frames.emplace_back(data); };
+
+  auto fixed = ScreenInteractive::Headless(20, 3, "aaa");
+  auto alternative = ScreenInteractive::Headless(20, 3, "aaa", output, true);
+  fixed.Loop(component);
+  alternative.Loop(component);
+
+  // Only the first frame draws the rows. The next ones are unchanged, and only
+  // move the cursor.
+  ASSERT_EQ(alternative.stats().frames, 4);
+  EXPECT_NE(frames[0].find("third line"), std::string::npos);
+  for (int i = 1; i < 4; ++i) {
+    EXPECT_EQ(frames[i].find("line"), std::string::npos);
+    EXPECT_LT(frames[i].size(), frames[0].size() / 2);
+  }
+  EXPECT_LT(alternative.stats().bytes, fixed.stats().bytes);
+}
+
+// After WithRestoredIO, the alternative screen is entered again and cleared.
+// The next frame must draw every row.
+TEST(ScreenInteractive, RestoredIORedraw) {
+  std::vector<std::string> frames;
+  auto output = [&](std::string_view data) { frames.emplace_back(data); };
+  auto screen = ScreenInteractive::Headless(20, 2, "ab", output, true);
+
+  int restored = 0;
+  auto component = Renderer([] {
+    return vbox({
+        text("first line"),
+        text("second line"),
+    });
+  });
+  component |= CatchEvent([&](Event event) {
+    if (event == Event::Character('a')) {
+      screen.WithRestoredIO([&] { restored++; })();
+    }
+    return false;
+  });
+  screen.Loop(component);
+
+  EXPECT_EQ(restored, 1);
+  ASSERT_EQ(screen.stats().frames, 3);
+  EXPECT_NE(frames[0].find("second line"), std::string::npos);
+  EXPECT_NE(frames[1].find("second line"), std::string::npos);
+  EXPECT_EQ(frames[2].find("line"), std::string::npos);
+}
+
+TEST(ScreenInteractive, HeadlessEscape) {
+  std::vector<Event> events;
+  auto component = Renderer([] { return text(""); });
+  component |= CatchEvent([&](Event event) {
+    events.push_back(event);
+    return true;
+  });
+  auto screen = ScreenInteractive::Headless(1, 1, "a\x1B");
+  screen.Loop(component);
+
+  EXPECT_EQ(events, std::vector<Event>({Event::Character('a'), Event::Escape}));
+}
+
+TEST(ScreenInteractive, HeadlessVirtualClock) {
+  class Animated : public ComponentBase {
+   public:
+    Element Render() override { return text(""); }
+    bool OnEvent(Event /*event*/) override {
+      animation::RequestAnimationFrame();
+      return true;
+    }
+    void OnAnimation(animation::Params& params) override {
+      duration += params.duration();
+    }
+    animation::Duration duration{};
+  };
+
+  auto component = std::make_shared<Animated>();
+  auto screen = ScreenInteractive::Headless(1, 1, "abcd");
+  screen.Loop(component);
+
+  // Every step moves the clock by 15ms. The last animation frame requested is
+  // not run, the input being consumed.
+  EXPECT_EQ(screen.stats().events, 4);
+  EXPECT_EQ(screen.stats().animation_frames, 3);
+  EXPECT_EQ(component->duration, std::chrono::milliseconds(60));
+}
+
+// Only the components requesting the animation frames are drawn again.
+// Unhandled events, like the mouse moving, invalidate nothing.
+TEST(ScreenInteractive, InvalidateAnimatedOnly) {
+  class Spinner : public ComponentBase {
+   public:
+    Element Render() override {
+      renders++;
+      animation::RequestAnimationFrame();
+      return text(std::to_string(steps));
+    }
+    void OnAnimation(animation::Params& /*params*/) override { steps++; }
+    int renders = 0;
+    int steps = 0;
+  };
+
+  int panel_renders = 0;
+  Components children;
+  for (int i = 0; i < 200; ++i) {
+    auto panel = Renderer([&] {
+      panel_renders++;
+      return text("panel");
+    });
+    panel->SetCacheable(true);
+    children.push_back(panel);
+  }
+  auto spinner = std::make_shared<Spinner>();
+  spinner->SetCacheable(true);
+  children.push_back(spinner);
+  auto root = Container::Vertical(children);
+
+  std::string mouse_moves;
+  for (int i = 0; i < 10; ++i) {
+    mouse_moves += "\x1B[<35;5;5M";
+  }
+  auto screen = ScreenInteractive::Headless(10, 201, mouse_moves);
+  screen.Loop(root);
+
+  EXPECT_EQ(screen.stats().events, 10);
+  EXPECT_EQ(panel_renders, 200);
+  EXPECT_EQ(spinner->steps, 10);
+  EXPECT_EQ(spinner->renders, 11);
+}
+
 }  // namespace ftxui
 
 // Copyright 2021 Arthur Sonzogni. All rights reserved.
@@ -1,7 +1,11 @@
 #include <benchmark/benchmark.h>
 
-#include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted
-#include "ftxui/dom/node.hpp"      // for Render
+#include <memory>   // for make_shared
+#include <string>   // for to_string
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted, hflow
+#include "ftxui/dom/node.hpp"      // for Node, Render
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 namespace ftxui {
@@ -29,6 +33,77 @@ static void BencharkBasic(benchmark::State& state) {
 }
 BENCHMARK(BencharkBasic)->DenseRange(0, 256, 16);
 
+static Element Hflow(int items) {
+  Elements children;
+  children.reserve(items);
+  for (int i = 0; i < items; ++i) {
+    children.push_back(text(std::to_string(i)));
+  }
+  return hflow(std::move(children));
+}
+
+// Build and lay out a flow of |range(0)| items.
+static void BenchmarkHflow(benchmark::State& state) {
+  Screen screen(200, 200);
+  while (state.KeepRunning()) {
+    auto document = Hflow(state.range(0));
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkHflow)->Arg(1000)->Arg(10000);
+
+// Lay out the same flow again, with a different width every time.
+static void BenchmarkHflowResize(benchmark::State& state) {
+  auto document = Hflow(state.range(0));
+  int width = 100;
+  while (state.KeepRunning()) {
+    Screen screen(width, 200);
+    Render(screen, document);
+    width = width == 100 ? 101 : 100;
+  }
+}
+BENCHMARK(BenchmarkHflowResize)->Arg(1000)->Arg(10000);
+
+// Lay out the same flow again, at the same width.
+static void BenchmarkHflowRelayout(benchmark::State& state) {
+  auto document = Hflow(state.range(0));
+  Screen screen(100, 200);
+  while (state.KeepRunning()) {
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkHflowRelayout)->Arg(1000)->Arg(10000);
+
+// An item whose width can be changed between two layouts.
+class Resizable : public Node {
+ public:
+  explicit Resizable(const int* width) : width_(width) {}
+  void ComputeRequirement() override {
+    requirement_.min_x = *width_;
+    requirement_.min_y = 1;
+  }
+
+ private:
+  const int* width_;
+};
+
+// Lay out the same flow again, with only its last item modified.
+static void BenchmarkHflowLastItem(benchmark::State& state) {
+  int width = 1;
+  Elements children;
+  for (int i = 0; i < state.range(0) - 1; ++i) {
+    children.push_back(text(std::to_string(i)));
+  }
+  children.push_back(std::make_shared<Resizable>(&width));
+  auto document = hflow(std::move(children));
+  Screen screen(100, 200);
+  while (state.KeepRunning()) {
+    Render(screen, document);
+    width = width == 1 ? 2 : 1;
+  }
+}
+BENCHMARK(BenchmarkHflowLastItem)->Arg(1000)->Arg(10000);
+
 }  // namespace ftxui
 
 // Copyright 2021 Arthur Sonzogni. All rights reserved.
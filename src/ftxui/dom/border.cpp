@@ -56,13 +56,13 @@ class Border : public Node {
       title_box.x_max = box.x_max - 1;
       title_box.y_min = box.y_min;
       title_box.y_max = box.y_min;
-      children_[1]->SetBox(title_box);
+      children_[1]->SetBoxIfNeeded(title_box);
     }
     box.x_min++;
     box.x_max--;
     box.y_min++;
     box.y_max--;
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfNeeded(box);
   }
 
   void Render(Screen& screen) override {
@@ -84,17 +84,21 @@ class Border : public Node {
       Pixel& p2 = screen.PixelAt(x, box_.y_max);
       p1.character = charset_[4];  // NOLINT
       p2.character = charset_[4];  // NOLINT
-      p1.automerge = true;
-      p2.automerge = true;
     }
     for (int y = box_.y_min + 1; y < box_.y_max; ++y) {
       Pixel& p3 = screen.PixelAt(box_.x_min, y);
       Pixel& p4 = screen.PixelAt(box_.x_max, y);
       p3.character = charset_[5];  // NOLINT
       p4.character = charset_[5];  // NOLINT
-      p3.automerge = true;
-      p4.automerge = true;
     }
+    const int x_min = box_.x_min + 1;
+    const int x_max = box_.x_max - 1;
+    const int y_min = box_.y_min + 1;
+    const int y_max = box_.y_max - 1;
+    screen.MarkAutomerge({x_min, x_max, box_.y_min, box_.y_min});
+    screen.MarkAutomerge({x_min, x_max, box_.y_max, box_.y_max});
+    screen.MarkAutomerge({box_.x_min, box_.x_min, y_min, y_max});
+    screen.MarkAutomerge({box_.x_max, box_.x_max, y_min, y_max});
 
     // Draw title.
     if (children_.size() == 2) {
@@ -135,13 +139,13 @@ class BorderPixel : public Node {
       title_box.x_max = box.x_max - 1;
       title_box.y_min = box.y_min;
       title_box.y_max = box.y_min;
-      children_[1]->SetBox(title_box);
+      children_[1]->SetBoxIfNeeded(title_box);
     }
     box.x_min++;
     box.x_max--;
     box.y_min++;
     box.y_max--;
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfNeeded(box);
   }
 
   void Render(Screen& screen) override {
@@ -1,10 +1,10 @@
 #include "ftxui/dom/canvas.hpp"
 
-#include <algorithm>               // for max, min
+#include <algorithm>               // for max, min, fill, sort
+#include <cmath>                   // for ceil, floor
 #include <cstdint>                 // for uint8_t
 #include <cstdlib>                 // for abs
 #include <ftxui/screen/color.hpp>  // for Color
-#include <map>                     // for map
 #include <memory>                  // for make_shared
 #include <utility>                 // for move, pair
 #include <vector>                  // for vector
@@ -21,10 +21,7 @@ namespace ftxui {
 
 namespace {
 
-// Base UTF8 pattern:
-// 11100010 10100000 10000000 // empty
-
-// Pattern for the individuel dots:
+// Braille characters are U+2800 plus an 8 bits mask, one bit per dot:
 // ┌──────┬───────┐
 // │dot1  │ dot4  │
 // ├──────┼───────┤
@@ -32,48 +29,43 @@ namespace {
 // ├──────┼───────┤
 // │dot3  │ dot6  │
 // ├──────┼───────┤
-// │dot0-1│ dot0-2│
+// │dot7  │ dot8  │
 // └──────┴───────┘
-// 11100010 10100000 10000001 // dot1
-// 11100010 10100000 10000010 // dot2
-// 11100010 10100000 10000100 // dot3
-// 11100010 10100001 10000000 // dot0-1
-// 11100010 10100000 10001000 // dot4
-// 11100010 10100000 10010000 // dot5
-// 11100010 10100000 10100000 // dot6
-// 11100010 10100010 10000000 // dot0-2
+// The mask is stored as is. The UTF8 glyph is only produced when the cell is
+// read:
+// 11100010 101000hg 10fedcba
 
 // NOLINTNEXTLINE
-uint8_t g_map_braille[2][4][2] = {
+const uint8_t g_map_braille[2][4] = {
     {
-        {0b00000000, 0b00000001},  // NOLINT | dot1
-        {0b00000000, 0b00000010},  // NOLINT | dot2
-        {0b00000000, 0b00000100},  // NOLINT | dot3
-        {0b00000001, 0b00000000},  // NOLINT | dot0-1
+        0b00000001,  // NOLINT | dot1
+        0b00000010,  // NOLINT | dot2
+        0b00000100,  // NOLINT | dot3
+        0b01000000,  // NOLINT | dot7
     },
     {
-        {0b00000000, 0b00001000},  // NOLINT | dot4
-        {0b00000000, 0b00010000},  // NOLINT | dot5
-        {0b00000000, 0b00100000},  // NOLINT | dot6
-        {0b00000010, 0b00000000},  // NOLINT | dot0-2
+        0b00001000,  // NOLINT | dot4
+        0b00010000,  // NOLINT | dot5
+        0b00100000,  // NOLINT | dot6
+        0b10000000,  // NOLINT | dot8
     },
 };
 
+std::string BrailleGlyph(uint8_t mask) {
+  std::string glyph = "⠀";  // 3 bytes.
+  glyph[1] = char(0b10100000U | (mask >> 6U));          // NOLINT
+  glyph[2] = char(0b10000000U | (mask & 0b00111111U));  // NOLINT
+  return glyph;
+}
+
 // NOLINTNEXTLINE
 std::vector<std::string> g_map_block = {
     " ", "▘", "▖", "▌", "▝", "▀", "▞", "▛",
     "▗", "▚", "▄", "▙", "▐", "▜", "▟", "█",
 };
 
-// NOLINTNEXTLINE
-const std::map<std::string, uint8_t> g_map_block_inversed = {
-    {" ", 0b0000}, {"▘", 0b0001}, {"▖", 0b0010}, {"▌", 0b0011},
-    {"▝", 0b0100}, {"▀", 0b0101}, {"▞", 0b0110}, {"▛", 0b0111},
-    {"▗", 0b1000}, {"▚", 0b1001}, {"▄", 0b1010}, {"▙", 0b1011},
-    {"▐", 0b1100}, {"▜", 0b1101}, {"▟", 0b1110}, {"█", 0b1111},
-};
-
-constexpr auto nostyle = [](Pixel& /*pixel*/) {};
+// Drawing without style leaves the style layer untouched.
+const Canvas::Stylizer nostyle;  // NOLINT
 
 }  // namespace
 
@@ -83,14 +75,32 @@ constexpr auto nostyle = [](Pixel& /*pixel*/) {};
 Canvas::Canvas(int width, int height)
     : width_(width),
       height_(height),
-      storage_(width_ * height_ / 8 /* NOLINT */) {}
+      cells_x_((width + 1) / 2),
+      cells_y_((height + 3) / 4),
+      cells_(cells_x_ * cells_y_) {}
 
 /// @brief Get the content of a cell.
 /// @param x the x coordinate of the cell.
 /// @param y the y coordinate of the cell.
 Pixel Canvas::GetPixel(int x, int y) const {
-  auto it = storage_.find(XY{x, y});
-  return (it == storage_.end()) ? Pixel{} : it->second.content;
+  if (x < 0 || x >= cells_x_ || y < 0 || y >= cells_y_) {
+    return Pixel{};
+  }
+  const int index = x + y * cells_x_;
+  auto it = pixels_.find(index);
+  Pixel pixel = (it == pixels_.end()) ? Pixel{} : it->second;
+  const Cell& cell = cells_[index];
+  switch (cell.type) {
+    case CellType::kBraille:
+      pixel.character = BrailleGlyph(cell.mask);
+      break;
+    case CellType::kBlock:
+      pixel.character = g_map_block[cell.mask];
+      break;
+    case CellType::kText:
+      break;
+  }
+  return pixel;
 }
 
 /// @brief Draw a braille dot.
@@ -98,7 +108,7 @@ Pixel Canvas::GetPixel(int x, int y) const {
 /// @param y the y coordinate of the dot.
 /// @param value whether the dot is filled or not.
 void Canvas::DrawPoint(int x, int y, bool value) {
-  DrawPoint(x, y, value, [](Pixel& /*pixel*/) {});
+  DrawPoint(x, y, value, nostyle);
 }
 
 /// @brief Draw a braille dot.
@@ -131,14 +141,8 @@ void Canvas::DrawPointOn(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 bytes.
-    cell.type = CellType::kBraille;
-  }
-
-  cell.content.character[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  Cell& cell = CellAt(x, y, CellType::kBraille);
+  cell.mask |= g_map_braille[x % 2][y % 4];
 }
 
 /// @brief Erase a braille dot.
@@ -148,14 +152,8 @@ void Canvas::DrawPointOff(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 byt
-    cell.type = CellType::kBraille;
-  }
-
-  cell.content.character[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
-  cell.content.character[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  Cell& cell = CellAt(x, y, CellType::kBraille);
+  cell.mask &= uint8_t(~g_map_braille[x % 2][y % 4]);
 }
 
 /// @brief Toggle a braille dot. A filled one will be erased, and the other will
@@ -166,14 +164,93 @@ void Canvas::DrawPointToggle(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 byt
-    cell.type = CellType::kBraille;
+  Cell& cell = CellAt(x, y, CellType::kBraille);
+  cell.mask ^= g_map_braille[x % 2][y % 4];
+}
+
+/// @brief Start a new shape. Each cell is styled at most once per shape.
+void Canvas::NewShape() {
+  if (++shape_ == 0) {
+    std::fill(styled_.begin(), styled_.end(), 0);
+    shape_ = 1;
+  }
+}
+
+/// @brief Apply |style| to the cell |index|, unless the current shape already
+/// did.
+void Canvas::StyleOnce(int index, const Stylizer& style) {
+  if (!style) {
+    return;
+  }
+  if (styled_.empty()) {
+    styled_.resize(cells_.size(), 0);
+  }
+  if (styled_[index] == shape_) {
+    return;
+  }
+  styled_[index] = shape_;
+  MarkDirty(index);
+  style(pixels_[index]);
+}
+
+/// @brief Draw a braille dot, as part of the current shape.
+void Canvas::PlotPoint(int x, int y, const Stylizer& style) {
+  if (!IsIn(x, y)) {
+    return;
+  }
+  CellAt(x, y, CellType::kBraille).mask |= g_map_braille[x % 2][y % 4];
+  StyleOnce(x / 2 + (y / 4) * cells_x_, style);
+}
+
+/// @brief Draw the braille dots from |x_begin| to |x_end| included on the row
+/// |y|, as part of the current shape. The two dots of a cell are set at once.
+void Canvas::PlotSpan(int x_begin, int x_end, int y, const Stylizer& style) {
+  if (y < 0 || y >= height_) {
+    return;
+  }
+  x_begin = std::max(x_begin, 0);
+  x_end = std::min(x_end, width_ - 1);
+  if (x_begin > x_end) {
+    return;
   }
 
-  cell.content.character[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  const uint8_t left = g_map_braille[0][y % 4];
+  const uint8_t right = g_map_braille[1][y % 4];
+  const int cell_begin = x_begin / 2;
+  const int cell_end = x_end / 2;
+  const int row = (y / 4) * cells_x_;
+  for (int x = cell_begin; x <= cell_end; ++x) {
+    uint8_t mask = left | right;
+    if (x == cell_begin && x_begin % 2 == 1) {
+      mask = right;
+    }
+    if (x == cell_end && x_end % 2 == 0) {
+      mask &= left;
+    }
+    CellAt(2 * x, y, CellType::kBraille).mask |= mask;
+    StyleOnce(row + x, style);
+  }
+}
+
+/// @brief Draw the braille dots from |y_begin| to |y_end| included on the
+/// column |x|, as part of the current shape. The dots of a cell are set at
+/// once.
+void Canvas::PlotColumn(int x, int y_begin, int y_end, const Stylizer& style) {
+  if (x < 0 || x >= width_) {
+    return;
+  }
+  y_begin = std::max(y_begin, 0);
+  y_end = std::min(y_end, height_ - 1);
+  for (int y = y_begin; y <= y_end;) {
+    const int y_cell_end = std::min(y_end, y - y % 4 + 3);
+    uint8_t mask = 0;
+    for (int i = y; i <= y_cell_end; ++i) {
+      mask |= g_map_braille[x % 2][i % 4];
+    }
+    CellAt(x, y, CellType::kBraille).mask |= mask;
+    StyleOnce(x / 2 + (y / 4) * cells_x_, style);
+    y = y_cell_end + 1;
+  }
 }
 
 /// @brief Draw a line made of braille dots.
@@ -182,7 +259,7 @@ void Canvas::DrawPointToggle(int x, int y) {
 /// @param x2 the x coordinate of the second dot.
 /// @param y2 the y coordinate of the second dot.
 void Canvas::DrawPointLine(int x1, int y1, int x2, int y2) {
-  DrawPointLine(x1, y1, x2, y2, [](Pixel& /*pixel*/) {});
+  DrawPointLine(x1, y1, x2, y2, nostyle);
 }
 
 /// @brief Draw a line made of braille dots.
@@ -207,6 +284,12 @@ void Canvas::DrawPointLine(int x1,
                            int x2,
                            int y2,
                            const Stylizer& style) {
+  NewShape();
+  PlotLine(x1, y1, x2, y2, style);
+}
+
+/// @brief Draw a braille line, as part of the current shape.
+void Canvas::PlotLine(int x1, int y1, int x2, int y2, const Stylizer& style) {
   const int dx = std::abs(x2 - x1);
   const int dy = std::abs(y2 - y1);
   const int sx = x1 < x2 ? 1 : -1;
@@ -222,7 +305,7 @@ void Canvas::DrawPointLine(int x1,
 
   int error = dx - dy;
   for (int i = 0; i < length; ++i) {
-    DrawPoint(x1, y1, true, style);
+    PlotPoint(x1, y1, style);
     if (2 * error >= -dy) {
       error -= dy;
       x1 += sx;
@@ -232,7 +315,7 @@ void Canvas::DrawPointLine(int x1,
       y1 += sy;
     }
   }
-  DrawPoint(x2, y2, true, style);
+  PlotPoint(x2, y2, style);
 }
 
 /// @brief Draw a circle made of braille dots.
@@ -240,7 +323,7 @@ void Canvas::DrawPointLine(int x1,
 /// @param y the y coordinate of the center of the circle.
 /// @param radius the radius of the circle.
 void Canvas::DrawPointCircle(int x, int y, int radius) {
-  DrawPointCircle(x, y, radius, [](Pixel& /*pixel*/) {});
+  DrawPointCircle(x, y, radius, nostyle);
 }
 
 /// @brief Draw a circle made of braille dots.
@@ -267,7 +350,7 @@ void Canvas::DrawPointCircle(int x, int y, int radius, const Stylizer& style) {
 /// @param y the y coordinate of the center of the circle.
 /// @param radius the radius of the circle.
 void Canvas::DrawPointCircleFilled(int x, int y, int radius) {
-  DrawPointCircleFilled(x, y, radius, [](Pixel& /*pixel*/) {});
+  DrawPointCircleFilled(x, y, radius, nostyle);
 }
 
 /// @brief Draw a filled circle made of braille dots.
@@ -301,7 +384,7 @@ void Canvas::DrawPointCircleFilled(int x,
 /// @param r1 the radius of the ellipse along the x axis.
 /// @param r2 the radius of the ellipse along the y axis.
 void Canvas::DrawPointEllipse(int x, int y, int r1, int r2) {
-  DrawPointEllipse(x, y, r1, r2, [](Pixel& /*pixel*/) {});
+  DrawPointEllipse(x, y, r1, r2, nostyle);
 }
 
 /// @brief Draw an ellipse made of braille dots.
@@ -330,6 +413,7 @@ void Canvas::DrawPointEllipse(int x1,
                               int r1,
                               int r2,
                               const Stylizer& s) {
+  NewShape();
   int x = -r1;
   int y = 0;
   int e2 = r2;
@@ -338,10 +422,10 @@ void Canvas::DrawPointEllipse(int x1,
   int err = dx + dy;
 
   do {
-    DrawPoint(x1 - x, y1 + y, true, s);
-    DrawPoint(x1 + x, y1 + y, true, s);
-    DrawPoint(x1 + x, y1 - y, true, s);
-    DrawPoint(x1 - x, y1 - y, true, s);
+    PlotPoint(x1 - x, y1 + y, s);
+    PlotPoint(x1 + x, y1 + y, s);
+    PlotPoint(x1 + x, y1 - y, s);
+    PlotPoint(x1 - x, y1 - y, s);
     e2 = 2 * err;
     if (e2 >= dx) {
       x++;
@@ -354,8 +438,8 @@ void Canvas::DrawPointEllipse(int x1,
   } while (x <= 0);
 
   while (y++ < r2) {
-    DrawPoint(x1, y1 + y, true, s);
-    DrawPoint(x1, y1 - y, true, s);
+    PlotPoint(x1, y1 + y, s);
+    PlotPoint(x1, y1 - y, s);
   }
 }
 
@@ -365,7 +449,7 @@ void Canvas::DrawPointEllipse(int x1,
 /// @param r1 the radius of the ellipse along the x axis.
 /// @param r2 the radius of the ellipse along the y axis.
 void Canvas::DrawPointEllipseFilled(int x1, int y1, int r1, int r2) {
-  DrawPointEllipseFilled(x1, y1, r1, r2, [](Pixel& /*pixel*/) {});
+  DrawPointEllipseFilled(x1, y1, r1, r2, nostyle);
 }
 
 /// @brief Draw a filled ellipse made of braille dots.
@@ -394,6 +478,17 @@ void Canvas::DrawPointEllipseFilled(int x1,
                                     int r1,
                                     int r2,
                                     const Stylizer& s) {
+  NewShape();
+  // half_width[dy] is the half width of the rows y1 + dy and y1 - dy, or -1
+  // when they are empty. Every row is then filled with a single span.
+  std::vector<int> half_width;
+  auto extend = [&](int dy, int width) {
+    if (dy >= (int)half_width.size()) {
+      half_width.resize(dy + 1, -1);
+    }
+    half_width[dy] = std::max(half_width[dy], width);
+  };
+
   int x = -r1;
   int y = 0;
   int e2 = r2;
@@ -402,10 +497,7 @@ void Canvas::DrawPointEllipseFilled(int x1,
   int err = dx + dy;
 
   do {
-    for (int xx = x1 + x; xx <= x1 - x; ++xx) {
-      DrawPoint(xx, y1 + y, true, s);
-      DrawPoint(xx, y1 - y, true, s);
-    }
+    extend(y, -x);
     e2 = 2 * err;
     if (e2 >= dx) {
       x++;
@@ -418,8 +510,168 @@ void Canvas::DrawPointEllipseFilled(int x1,
   } while (x <= 0);
 
   while (y++ < r2) {
-    for (int yy = y1 - y; yy <= y1 + y; ++yy) {
-      DrawPoint(x1, yy, true, s);
+    extend(y, 0);
+  }
+
+  for (int i = 0; i < (int)half_width.size(); ++i) {
+    const int width = half_width[i];
+    if (width < 0) {
+      continue;
+    }
+    PlotSpan(x1 - width, x1 + width, y1 + i, s);
+    if (i != 0) {
+      PlotSpan(x1 - width, x1 + width, y1 - i, s);
+    }
+  }
+}
+
+/// @brief Draw lines made of braille dots, joining consecutive points.
+/// @param points the points to join.
+void Canvas::DrawPointPolyline(const std::vector<Point>& points) {
+  DrawPointPolyline(points, nostyle);
+}
+
+/// @brief Draw lines made of braille dots, joining consecutive points.
+/// @param points the points to join.
+/// @param color the color of the lines.
+void Canvas::DrawPointPolyline(const std::vector<Point>& points,
+                               const Color& color) {
+  DrawPointPolyline(points, [color](Pixel& p) { p.foreground_color = color; });
+}
+
+/// @brief Draw lines made of braille dots, joining consecutive points.
+/// @param points the points to join.
+/// @param style the style of the lines. It is applied once per cell.
+void Canvas::DrawPointPolyline(const std::vector<Point>& points,
+                               const Stylizer& style) {
+  NewShape();
+  if (points.size() == 1) {
+    PlotPoint(points[0].x, points[0].y, style);
+  }
+  for (size_t i = 1; i < points.size(); ++i) {
+    PlotLine(points[i - 1].x, points[i - 1].y, points[i].x, points[i].y,
+             style);
+  }
+}
+
+/// @brief Draw a set of braille dots.
+/// @param points the dots to draw.
+void Canvas::DrawPointScatter(const std::vector<Point>& points) {
+  DrawPointScatter(points, nostyle);
+}
+
+/// @brief Draw a set of braille dots.
+/// @param points the dots to draw.
+/// @param color the color of the dots.
+void Canvas::DrawPointScatter(const std::vector<Point>& points,
+                              const Color& color) {
+  DrawPointScatter(points, [color](Pixel& p) { p.foreground_color = color; });
+}
+
+/// @brief Draw a set of braille dots.
+/// @param points the dots to draw.
+/// @param style the style of the dots. It is applied once per cell.
+void Canvas::DrawPointScatter(const std::vector<Point>& points,
+                              const Stylizer& style) {
+  NewShape();
+  for (const auto& point : points) {
+    PlotPoint(point.x, point.y, style);
+  }
+}
+
+/// @brief Draw a filled polygon made of braille dots.
+/// @param points the vertices of the polygon.
+void Canvas::DrawPointPolygonFilled(const std::vector<Point>& points) {
+  DrawPointPolygonFilled(points, nostyle);
+}
+
+/// @brief Draw a filled polygon made of braille dots.
+/// @param points the vertices of the polygon.
+/// @param color the color of the polygon.
+void Canvas::DrawPointPolygonFilled(const std::vector<Point>& points,
+                                    const Color& color) {
+  DrawPointPolygonFilled(points,
+                         [color](Pixel& p) { p.foreground_color = color; });
+}
+
+/// @brief Draw a filled polygon made of braille dots. The polygon doesn't need
+/// to be convex. Its inside is defined by the even-odd rule.
+/// @param points the vertices of the polygon.
+/// @param style the style of the polygon. It is applied once per cell.
+void Canvas::DrawPointPolygonFilled(const std::vector<Point>& points,
+                                    const Stylizer& style) {
+  NewShape();
+  if (points.empty()) {
+    return;
+  }
+
+  // The edges:
+  const size_t n = points.size();
+  for (size_t i = 0; i < n; ++i) {
+    const Point& a = points[i];
+    const Point& b = points[(i + 1) % n];
+    PlotLine(a.x, a.y, b.x, b.y, style);
+  }
+
+  // The inside, filled one row at a time:
+  int y_min = points[0].y;
+  int y_max = points[0].y;
+  for (const auto& point : points) {
+    y_min = std::min(y_min, point.y);
+    y_max = std::max(y_max, point.y);
+  }
+  y_min = std::max(y_min, 0);
+  y_max = std::min(y_max, height_ - 1);
+
+  std::vector<float> crossings;
+  for (int y = y_min; y <= y_max; ++y) {
+    crossings.clear();
+    for (size_t i = 0; i < n; ++i) {
+      const Point& a = points[i];
+      const Point& b = points[(i + 1) % n];
+      if ((a.y <= y && y < b.y) || (b.y <= y && y < a.y)) {
+        crossings.push_back(float(a.x) + float(y - a.y) * float(b.x - a.x) /
+                                             float(b.y - a.y));
+      }
+    }
+    std::sort(crossings.begin(), crossings.end());
+    for (size_t i = 0; i + 1 < crossings.size(); i += 2) {
+      PlotSpan(int(std::ceil(crossings[i])), int(std::floor(crossings[i + 1])),
+               y, style);
+    }
+  }
+}
+
+/// @brief Draw a histogram made of braille dots. The bar |i| is drawn in the
+/// column x = i, from the bottom of the canvas, with a height of values[i]
+/// dots.
+/// @param values the height of the bars.
+void Canvas::DrawPointHistogram(const std::vector<int>& values) {
+  DrawPointHistogram(values, nostyle);
+}
+
+/// @brief Draw a histogram made of braille dots. The bar |i| is drawn in the
+/// column x = i, from the bottom of the canvas, with a height of values[i]
+/// dots.
+/// @param values the height of the bars.
+/// @param color the color of the bars.
+void Canvas::DrawPointHistogram(const std::vector<int>& values,
+                                const Color& color) {
+  DrawPointHistogram(values, [color](Pixel& p) { p.foreground_color = color; });
+}
+
+/// @brief Draw a histogram made of braille dots. The bar |i| is drawn in the
+/// column x = i, from the bottom of the canvas, with a height of values[i]
+/// dots.
+/// @param values the height of the bars.
+/// @param style the style of the bars. It is applied once per cell.
+void Canvas::DrawPointHistogram(const std::vector<int>& values,
+                                const Stylizer& style) {
+  NewShape();
+  const int size = std::min((int)values.size(), width_);
+  for (int x = 0; x < size; ++x) {
+    if (values[x] > 0) {
+      PlotColumn(x, height_ - values[x], height_ - 1, style);
     }
   }
 }
@@ -429,7 +681,7 @@ void Canvas::DrawPointEllipseFilled(int x1,
 /// @param y the y coordinate of the block.
 /// @param value whether the block is filled or not.
 void Canvas::DrawBlock(int x, int y, bool value) {
-  DrawBlock(x, y, value, [](Pixel& /*pixel*/) {});
+  DrawBlock(x, y, value, nostyle);
 }
 
 /// @brief Draw a block.
@@ -462,17 +714,11 @@ void Canvas::DrawBlockOn(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
+  Cell& cell = CellAt(x, y, CellType::kBlock);
   y /= 2;
-  Cell& cell = storage_[XY{x / 2, y / 2}];
-  if (cell.type != CellType::kBlock) {
-    cell.content.character = " ";
-    cell.type = CellType::kBlock;
-  }
 
-  uint8_t bit = (x % 2) * 2 + y % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
-  value |= 1U << bit;
-  cell.content.character = g_map_block[value];
+  const uint8_t bit = (x % 2) * 2 + y % 2;
+  cell.mask |= 1U << bit;
 }
 
 /// @brief Erase a block.
@@ -482,17 +728,11 @@ void Canvas::DrawBlockOff(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBlock) {
-    cell.content.character = " ";
-    cell.type = CellType::kBlock;
-  }
+  Cell& cell = CellAt(x, y, CellType::kBlock);
   y /= 2;
 
-  uint8_t bit = (y % 2) * 2 + x % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
-  value &= ~(1U << bit);
-  cell.content.character = g_map_block[value];
+  const uint8_t bit = (y % 2) * 2 + x % 2;
+  cell.mask &= uint8_t(~(1U << bit));
 }
 
 /// @brief Toggle a block. If it is filled, it will be erased. If it is empty,
@@ -503,17 +743,11 @@ void Canvas::DrawBlockToggle(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBlock) {
-    cell.content.character = " ";
-    cell.type = CellType::kBlock;
-  }
+  Cell& cell = CellAt(x, y, CellType::kBlock);
   y /= 2;
 
-  uint8_t bit = (y % 2) * 2 + x % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
-  value ^= 1U << bit;
-  cell.content.character = g_map_block[value];
+  const uint8_t bit = (y % 2) * 2 + x % 2;
+  cell.mask ^= 1U << bit;
 }
 
 /// @brief Draw a line made of block characters.
@@ -522,7 +756,7 @@ void Canvas::DrawBlockToggle(int x, int y) {
 /// @param x2 the x coordinate of the second point of the line.
 /// @param y2 the y coordinate of the second point of the line.
 void Canvas::DrawBlockLine(int x1, int y1, int x2, int y2) {
-  DrawBlockLine(x1, y1, x2, y2, [](Pixel& /*pixel*/) {});
+  DrawBlockLine(x1, y1, x2, y2, nostyle);
 }
 
 /// @brief Draw a line made of block characters.
@@ -805,10 +1039,12 @@ void Canvas::DrawText(int x,
       x += 2;
       continue;
     }
-    Cell& cell = storage_[XY{x / 2, y / 4}];
-    cell.type = CellType::kText;
-    cell.content.character = it;
-    style(cell.content);
+    CellAt(x, y, CellType::kText);
+    Pixel& pixel = pixels_[x / 2 + (y / 4) * cells_x_];
+    pixel.character = it;
+    if (style) {
+      style(pixel);
+    }
     x += 2;
   }
 }
@@ -816,8 +1052,99 @@ void Canvas::DrawText(int x,
 /// @brief Modify a pixel at a given location.
 /// @param style a function that modifies the pixel.
 void Canvas::Style(int x, int y, const Stylizer& style) {
-  if (IsIn(x, y)) {
-    style(storage_[XY{x / 2, y / 4}].content);
+  if (IsIn(x, y) && style) {
+    const int index = x / 2 + (y / 4) * cells_x_;
+    MarkDirty(index);
+    style(pixels_[index]);
+  }
+}
+
+/// @brief Move the content of the canvas. The uncovered area is left empty.
+/// This is useful to scroll charts, drawing only the new data.
+/// @param dx the horizontal offset. It is considered to be a multiple of 2.
+/// @param dy the vertical offset. It is considered to be a multiple of 4.
+void Canvas::Shift(int dx, int dy) {
+  const int sx = dx / 2;
+  const int sy = dy / 4;
+  if (sx == 0 && sy == 0) {
+    return;
+  }
+
+  const bool cached = !cache_.pixels.empty();
+  std::vector<Cell> cells(cells_.size());
+  std::vector<Pixel> pixels(cache_.pixels.size());
+  for (int y = 0; y < cells_y_; ++y) {
+    const int from_y = y - sy;
+    for (int x = 0; x < cells_x_; ++x) {
+      const int from_x = x - sx;
+      if (from_x < 0 || from_x >= cells_x_ || from_y < 0 ||
+          from_y >= cells_y_) {
+        continue;
+      }
+      const int from = from_x + from_y * cells_x_;
+      cells[x + y * cells_x_] = cells_[from];
+      if (cached) {
+        pixels[x + y * cells_x_] = std::move(cache_.pixels[from]);
+      }
+    }
+  }
+  cells_ = std::move(cells);
+  cache_.pixels = std::move(pixels);
+
+  std::unordered_map<int, Pixel> styles;
+  for (auto& it : pixels_) {
+    const int x = it.first % cells_x_ + sx;
+    const int y = it.first / cells_x_ + sy;
+    if (x >= 0 && x < cells_x_ && y >= 0 && y < cells_y_) {
+      styles[x + y * cells_x_] = std::move(it.second);
+    }
+  }
+  pixels_ = std::move(styles);
+
+  // The pending modifications moved with their cells. The shifted cached
+  // Pixels are still valid.
+  if (cached) {
+    std::vector<bool> dirty(cache_.dirty.size(), false);
+    std::vector<int> dirty_list;
+    for (const int index : cache_.dirty_list) {
+      const int x = index % cells_x_ + sx;
+      const int y = index / cells_x_ + sy;
+      if (x >= 0 && x < cells_x_ && y >= 0 && y < cells_y_) {
+        dirty[x + y * cells_x_] = true;
+        dirty_list.push_back(x + y * cells_x_);
+      }
+    }
+    cache_.dirty = std::move(dirty);
+    cache_.dirty_list = std::move(dirty_list);
+  }
+}
+
+/// @brief Copy the canvas into a screen. The Pixels are kept from one call to
+/// the next, and only the modified cells are converted again.
+/// @param screen the screen to draw on.
+/// @param box the area of the screen to draw into.
+void Canvas::DrawOn(Screen& screen, const Box& box) const {
+  if (cache_.pixels.size() != cells_.size()) {
+    cache_.pixels.resize(cells_.size());
+    for (int i = 0; i < (int)cells_.size(); ++i) {
+      cache_.pixels[i] = GetPixel(i % cells_x_, i / cells_x_);
+    }
+    cache_.dirty.assign(cells_.size(), false);
+    cache_.dirty_list.clear();
+  }
+  for (const int index : cache_.dirty_list) {
+    cache_.pixels[index] = GetPixel(index % cells_x_, index / cells_x_);
+    cache_.dirty[index] = false;
+  }
+  cache_.dirty_list.clear();
+
+  const int y_max = std::min(height_ / 4, box.y_max - box.y_min + 1);
+  const int x_max = std::min(width_ / 2, box.x_max - box.x_min + 1);
+  for (int y = 0; y < y_max; ++y) {
+    for (int x = 0; x < x_max; ++x) {
+      screen.PixelAt(box.x_min + x, box.y_min + y) =
+          cache_.pixels[x + y * cells_x_];
+    }
   }
 }
 
@@ -844,13 +1171,21 @@ class CanvasNodeBase : public Node {
 }  // namespace
 
 /// @brief Produce an element from a Canvas, or a reference to a Canvas.
+///
+/// A referenced Canvas keeps its content from one frame to the next. It can be
+/// updated incrementally, see `Canvas::Shift`. Only its modified cells are
+/// converted into Pixels when it is drawn.
 Element canvas(ConstRef<Canvas> canvas) {
   class Impl : public CanvasNodeBase {
    public:
     explicit Impl(ConstRef<Canvas> canvas) : canvas_(std::move(canvas)) {
       requirement_.min_x = (canvas_->width() + 1) / 2;
       requirement_.min_y = (canvas_->height() + 3) / 4;
+      requirement_final_ = true;
+      // The Canvas's Pixels cache might be shared with other elements.
+      concurrent_render_ = false;
     }
+    void Render(Screen& screen) final { canvas_->DrawOn(screen, box_); }
     const Canvas& canvas() final { return *canvas_; }
     ConstRef<Canvas> canvas_;
   };
@@ -865,11 +1200,10 @@ Element canvas(int width, int height, std::function<void(Canvas&)> fn) {
   class Impl : public CanvasNodeBase {
    public:
     Impl(int width, int height, std::function<void(Canvas&)> fn)
-        : width_(width), height_(height), fn_(std::move(fn)) {}
-
-    void ComputeRequirement() final {
+        : width_(width), height_(height), fn_(std::move(fn)) {
       requirement_.min_x = (width_ + 1) / 2;
       requirement_.min_y = (height_ + 3) / 4;
+      requirement_final_ = true;
     }
 
     void Render(Screen& screen) final {
@@ -6,7 +6,7 @@
 #include "ftxui/dom/elements.hpp"  // for canvas
 #include "ftxui/dom/node.hpp"      // for Render
 #include "ftxui/screen/color.hpp"  // for Color, Color::Black, Color::Blue, Color::Red, Color::White, Color::Yellow, Color::Cyan, Color::Green
-#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/screen.hpp"    // for Screen, Pixel
 #include "ftxui/screen/terminal.hpp"  // for SetColorSupport, Color, TrueColor
 
 namespace ftxui {
@@ -100,6 +100,101 @@ TEST(CanvasTest, GoldText) {
   EXPECT_EQ(Hash(screen.ToString()), 1074960375);
 }
 
+TEST(CanvasTest, GetPixel) {
+  Canvas c(10, 10);
+  for (int x = 0; x < 2; ++x) {
+    for (int y = 0; y < 4; ++y) {
+      c.DrawPointOn(x, y);
+    }
+  }
+  c.DrawPointOn(2, 3);
+  c.DrawBlockOn(4, 0);
+  c.DrawBlockOn(5, 2);
+  c.DrawText(6, 0, "a", Color::Red);
+  c.DrawPointOn(0, 4);
+  c.DrawPointOff(0, 4);
+
+  EXPECT_EQ(c.GetPixel(0, 0).character, "⣿");
+  EXPECT_EQ(c.GetPixel(1, 0).character, "⡀");
+  EXPECT_EQ(c.GetPixel(2, 0).character, "▚");
+  EXPECT_EQ(c.GetPixel(3, 0).character, "a");
+  EXPECT_EQ(c.GetPixel(3, 0).foreground_color, Color::Red);
+  EXPECT_EQ(c.GetPixel(0, 1).character, "⠀");
+  EXPECT_EQ(c.GetPixel(4, 0).character, " ");
+  EXPECT_EQ(c.GetPixel(42, 42).character, " ");
+}
+
+TEST(CanvasTest, Batch) {
+  Canvas c(8, 8);
+  c.DrawPointHistogram({1, 2, 8, 5});
+  c.DrawPointScatter({{4, 0}, {5, 1}, {7, 7}});
+  c.DrawPointPolygonFilled({{4, 4}, {5, 4}, {5, 6}, {4, 6}});
+  EXPECT_EQ(c.GetPixel(0, 0).character, " ");
+  EXPECT_EQ(c.GetPixel(0, 1).character, "⣠");
+  EXPECT_EQ(c.GetPixel(1, 0).character, "⣇");
+  EXPECT_EQ(c.GetPixel(1, 1).character, "⣿");
+  EXPECT_EQ(c.GetPixel(2, 0).character, "⠑");
+  EXPECT_EQ(c.GetPixel(2, 1).character, "⠿");
+  EXPECT_EQ(c.GetPixel(3, 1).character, "⢀");
+}
+
+TEST(CanvasTest, StyleOncePerCell) {
+  Canvas c(20, 20);
+  int calls = 0;
+  auto style = [&](Pixel& pixel) {
+    calls++;
+    pixel.bold = !pixel.bold;
+  };
+  c.DrawPointEllipseFilled(10, 10, 4, 4, style);
+  int cells = 0;
+  for (int y = 0; y < 5; ++y) {
+    for (int x = 0; x < 10; ++x) {
+      if (c.GetPixel(x, y).character != " ") {
+        cells++;
+        EXPECT_TRUE(c.GetPixel(x, y).bold);
+      }
+    }
+  }
+  EXPECT_EQ(calls, cells);
+
+  c.DrawPointPolyline({{0, 0}, {19, 0}, {19, 19}}, style);
+  EXPECT_EQ(calls, cells + 10 + 4);
+}
+
+TEST(CanvasTest, Shift) {
+  Canvas c(8, 8);
+  c.DrawPointOn(0, 0);
+  c.DrawText(2, 4, "a", Color::Red);
+  c.Shift(2, 0);
+  EXPECT_EQ(c.GetPixel(0, 0).character, " ");
+  EXPECT_EQ(c.GetPixel(1, 0).character, "⠁");
+  EXPECT_EQ(c.GetPixel(2, 1).character, "a");
+  EXPECT_EQ(c.GetPixel(2, 1).foreground_color, Color::Red);
+  c.Shift(-4, -4);
+  EXPECT_EQ(c.GetPixel(0, 0).character, "a");
+  EXPECT_EQ(c.GetPixel(1, 0).character, " ");
+}
+
+TEST(CanvasTest, IncrementalDraw) {
+  Canvas c(20, 8);
+  auto draw = [&] {
+    Screen incremental(10, 2);
+    Render(incremental, canvas(&c));
+    Screen full(10, 2);
+    Render(full, canvas(20, 8, [&](Canvas& copy) { copy = c; }));
+    EXPECT_EQ(incremental.ToString(), full.ToString());
+  };
+
+  for (int i = 0; i < 30; ++i) {
+    c.Shift(-2, 0);
+    c.DrawPointLine(18, i % 8, 19, (i * 3) % 8, Color::Blue);
+    if (i % 7 == 0) {
+      c.DrawText(18, 4, "x");
+    }
+    draw();
+  }
+}
+
 }  // namespace ftxui
 
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
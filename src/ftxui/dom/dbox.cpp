@@ -1,4 +1,5 @@
 #include <algorithm>  // for max
+#include <cstddef>    // for size_t
 #include <memory>     // for __shared_ptr_access, shared_ptr, make_shared
 #include <utility>    // for move
 #include <vector>     // for vector
@@ -7,6 +8,8 @@
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/parallel.hpp"  // for For
 
 namespace ftxui {
 
@@ -22,8 +25,13 @@ class DBox : public Node {
     requirement_.flex_shrink_x = 0;
     requirement_.flex_shrink_y = 0;
     requirement_.selection = Requirement::NORMAL;
+    // The requirement is a function of the children's one only.
+    requirement_final_ = true;
+    parallel::For(children_.size(), [&](size_t i) {
+      children_[i]->ComputeRequirementIfNeeded();
+    });
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      requirement_final_ &= child->requirement_final();
       requirement_.min_x =
           std::max(requirement_.min_x, child->requirement().min_x);
       requirement_.min_y =
@@ -39,8 +47,15 @@ class DBox : public Node {
   void SetBox(Box box) override {
     Node::SetBox(box);
 
+    parallel::For(children_.size(),
+                  [&](size_t i) { children_[i]->SetBoxIfNeeded(box); });
+  }
+
+  // The children overlap. They are drawn in order, so that the last one is on
+  // top. The dbox itself can still be drawn concurrently with its siblings.
+  void Render(Screen& screen) override {
     for (auto& child : children_) {
-      child->SetBox(box);
+      child->Render(screen);
     }
   }
 };
@@ -1,8 +1,9 @@
 #include <gtest/gtest.h>
-#include <string>  // for allocator
+#include <string>   // for allocator, string
+#include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"  // for filler, operator|, text, border, dbox, hbox, vbox, Element
-#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/node.hpp"       // for Render, SetParallelLayout
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 namespace ftxui {
@@ -28,6 +29,32 @@ TEST(DBoxTest, Basic) {
             "╰────╯  ");
 }
 
+// The layers overlap, the last one must be drawn on top even when the layout
+// is parallel.
+TEST(DBoxTest, ParallelLayers) {
+  auto layer = [](char c) {
+    Elements rows;
+    for (int y = 0; y < 50; ++y) {
+      rows.push_back(text(std::string(80, c)));
+    }
+    return vbox(std::move(rows));
+  };
+  Elements layers;
+  for (int i = 0; i < 64; ++i) {
+    layers.push_back(layer(char('0' + i % 10)));
+  }
+  auto root = dbox(std::move(layers));
+
+  SetParallelLayout(4);
+  for (int i = 0; i < 10; ++i) {
+    Screen screen(80, 50);
+    Render(screen, root);
+    std::string output = screen.ToString();
+    EXPECT_EQ(output.find_first_not_of("3\r\n"), std::string::npos);
+  }
+  SetParallelLayout(0);
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -73,7 +73,7 @@ class Flex : public Node {
     requirement_.min_x = 0;
     requirement_.min_y = 0;
     if (!children_.empty()) {
-      children_[0]->ComputeRequirement();
+      children_[0]->ComputeRequirementIfNeeded();
       requirement_ = children_[0]->requirement();
     }
     f_(requirement_);
@@ -83,7 +83,7 @@ class Flex : public Node {
     if (children_.empty()) {
       return;
     }
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfNeeded(box);
   }
 
   FlexFunction f_;
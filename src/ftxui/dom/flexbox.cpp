@@ -1,4 +1,5 @@
 #include <algorithm>  // for min, max
+#include <atomic>     // for atomic
 #include <cstddef>    // for size_t
 #include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type, make_shared
 #include <utility>  // for move, swap
@@ -6,10 +7,11 @@
 
 #include "ftxui/dom/elements.hpp"  // for Element, Elements, flexbox, hflow, vflow
 #include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::Direction::Column, FlexboxConfig::AlignContent, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::JustifyContent, FlexboxConfig::Wrap, FlexboxConfig::AlignContent::FlexStart, FlexboxConfig::Direction::RowInversed, FlexboxConfig::JustifyContent::FlexStart, FlexboxConfig::Wrap::Wrap
-#include "ftxui/dom/flexbox_helper.hpp"  // for Block, Global, Compute
+#include "ftxui/dom/flexbox_helper.hpp"  // for Block, Global, SetInput, Compute
 #include "ftxui/dom/node.hpp"            // for Node, Elements, Node::Status
 #include "ftxui/dom/requirement.hpp"     // for Requirement
 #include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/parallel.hpp"     // for For
 
 namespace ftxui {
 
@@ -53,6 +55,9 @@ class Flexbox : public Node {
       : Node(std::move(children)),
         config_(config),
         config_normalized_(Normalize(config)) {
+    initial_layout_.config = config_normalized_;
+    requirement_layout_.config = config_normalized_;
+    box_layout_.config = config_;
     requirement_.flex_grow_x = 1;
     requirement_.flex_grow_y = 0;
 
@@ -66,30 +71,38 @@ class Flexbox : public Node {
            config_.direction == FlexboxConfig::Direction::ColumnInversed;
   }
 
-  void Layout(flexbox_helper::Global& global,
+  // The blocks and their layout are kept from one call to the next. Only the
+  // blocks from the first modified one are laid out again.
+  // Returns whether the layout changed.
+  bool Layout(flexbox_helper::Global& global,
               bool compute_requirement = false) {
-    for (auto& child : children_) {
+    global.blocks.resize(children_.size());
+    for (size_t i = 0; i < children_.size(); ++i) {
+      const Requirement& requirement = children_[i]->requirement();
       flexbox_helper::Block block;
-      block.min_size_x = child->requirement().min_x;
-      block.min_size_y = child->requirement().min_y;
+      block.min_size_x = requirement.min_x;
+      block.min_size_y = requirement.min_y;
       if (!compute_requirement) {
-        block.flex_grow_x = child->requirement().flex_grow_x;
-        block.flex_grow_y = child->requirement().flex_grow_y;
-        block.flex_shrink_x = child->requirement().flex_shrink_x;
-        block.flex_shrink_y = child->requirement().flex_shrink_y;
+        block.flex_grow_x = requirement.flex_grow_x;
+        block.flex_grow_y = requirement.flex_grow_y;
+        block.flex_shrink_x = requirement.flex_shrink_x;
+        block.flex_shrink_y = requirement.flex_shrink_y;
       }
-      global.blocks.push_back(block);
+      flexbox_helper::SetInput(global, i, block);
     }
 
-    flexbox_helper::Compute(global);
+    return flexbox_helper::Compute(global);
   }
 
   void ComputeRequirement() override {
-    for (auto& child : children_) {
-      child->ComputeRequirement();
-    }
-    flexbox_helper::Global global;
-    global.config = config_normalized_;
+    parallel::For(children_.size(), [&](size_t i) {
+      children_[i]->ComputeRequirementIfNeeded();
+    });
+    // Every Render() starts over from the initial |asked_|. Laying it out in
+    // its own Global keeps both passes incremental, instead of alternating the
+    // size of a single one.
+    flexbox_helper::Global& global =
+        asked_ == kAskedInitial ? initial_layout_ : requirement_layout_;
     if (IsColumnOriented()) {
       global.size_x = 100000;  // NOLINT
       global.size_y = asked_;
@@ -150,14 +163,13 @@ class Flexbox : public Node {
                                                  : box.x_max - box.x_min + 1);
     need_iteration_ = (asked_ != asked_previous);
 
-    flexbox_helper::Global global;
-    global.config = config_;
+    flexbox_helper::Global& global = box_layout_;
     global.size_x = box.x_max - box.x_min + 1;
     global.size_y = box.y_max - box.y_min + 1;
-    Layout(global);
+    const bool changed = Layout(global);
 
-    for (size_t i = 0; i < children_.size(); ++i) {
-      auto& child = children_[i];
+    std::atomic<bool> clipped(false);
+    parallel::For(children_.size(), [&](size_t i) {
       auto& b = global.blocks[i];
 
       Box children_box;
@@ -167,29 +179,37 @@ class Flexbox : public Node {
       children_box.y_max = box.y_min + b.y + b.dim_y - 1;
 
       Box intersection = Box::Intersection(children_box, box);
-      child->SetBox(intersection);
+      children_[i]->SetBoxIfNeeded(intersection);
 
-      need_iteration_ |= (intersection != children_box);
-    }
+      if (intersection != children_box) {
+        clipped = true;
+      }
+    });
+    // Another iteration can't unclip the children if nothing moved.
+    need_iteration_ |= clipped && changed;
   }
 
   void Check(Status* status) override {
     for (auto& child : children_) {
-      child->Check(status);
+      child->CheckLayout(status);
     }
 
     if (status->iteration == 0) {
-      asked_ = 6000;  // NOLINT
+      asked_ = kAskedInitial;
       need_iteration_ = true;
     }
 
     status->need_iteration |= need_iteration_;
   }
 
-  int asked_ = 6000;  // NOLINT
+  static constexpr int kAskedInitial = 6000;
+  int asked_ = kAskedInitial;
   bool need_iteration_ = true;
   const FlexboxConfig config_;
   const FlexboxConfig config_normalized_;
+  flexbox_helper::Global initial_layout_;
+  flexbox_helper::Global requirement_layout_;
+  flexbox_helper::Global box_layout_;
 };
 
 }  // namespace
@@ -81,50 +81,68 @@ void SymmetryY(Global& g) {
   }
 }
 
-struct Line {
-  std::vector<Block*> blocks;
-};
-
-void SetX(Global& global, std::vector<Line> lines) {
-  for (auto& line : lines) {
-    std::vector<box_helper::Element> elements;
-    for (auto* block : line.blocks) {
+bool SameConfig(const FlexboxConfig& a, const FlexboxConfig& b) {
+  return a.direction == b.direction && a.wrap == b.wrap &&
+         a.justify_content == b.justify_content &&
+         a.align_items == b.align_items && a.align_content == b.align_content &&
+         a.gap_x == b.gap_x && a.gap_y == b.gap_y;
+}
+
+bool SameInput(const Block& a, const Block& b) {
+  return a.min_size_x == b.min_size_x && a.min_size_y == b.min_size_y &&
+         a.flex_grow_x == b.flex_grow_x && a.flex_grow_y == b.flex_grow_y &&
+         a.flex_shrink_x == b.flex_shrink_x &&
+         a.flex_shrink_y == b.flex_shrink_y;
+}
+
+// Set positions on the X axis, for the lines from |first_line|.
+void SetX(Global& global, size_t first_line) {
+  std::vector<box_helper::Element> elements;
+  for (size_t l = first_line; l < global.lines.size(); ++l) {
+    const Line& line = global.lines[l];
+    elements.clear();
+    for (size_t i = line.begin; i < line.end; ++i) {
+      const Block& block = global.blocks[i];
       box_helper::Element element;
-      element.min_size = block->min_size_x;
+      element.min_size = block.min_size_x;
       element.flex_grow =
-          block->flex_grow_x != 0 || global.config.justify_content ==
-                                         FlexboxConfig::JustifyContent::Stretch
+          block.flex_grow_x != 0 || global.config.justify_content ==
+                                        FlexboxConfig::JustifyContent::Stretch
               ? 1
               : 0;
-      element.flex_shrink = block->flex_shrink_x;
+      element.flex_shrink = block.flex_shrink_x;
       elements.push_back(element);
     }
 
     box_helper::Compute(
         &elements,
-        global.size_x - global.config.gap_x * (int(line.blocks.size()) - 1));
+        global.size_x - global.config.gap_x * (int(elements.size()) - 1));
 
     int x = 0;
-    for (size_t i = 0; i < line.blocks.size(); ++i) {
-      line.blocks[i]->dim_x = elements[i].size;
-      line.blocks[i]->x = x;
-      x += elements[i].size;
+    for (size_t i = line.begin; i < line.end; ++i) {
+      Block& block = global.blocks[i];
+      block.dim_x = elements[i - line.begin].size;
+      block.x = x;
+      x += block.dim_x;
       x += global.config.gap_x;
     }
   }
 }
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
-void SetY(Global& g, std::vector<Line> lines) {
+void SetY(Global& g) {
+  const std::vector<Line>& lines = g.lines;
   std::vector<box_helper::Element> elements;
-  for (auto& line : lines) {
+  elements.reserve(lines.size());
+  for (const auto& line : lines) {
     box_helper::Element element;
-    element.flex_shrink = line.blocks.front()->flex_shrink_y;
-    element.flex_grow = line.blocks.front()->flex_grow_y;
-    for (auto* block : line.blocks) {
-      element.min_size = std::max(element.min_size, block->min_size_y);
-      element.flex_shrink = std::min(element.flex_shrink, block->flex_shrink_y);
-      element.flex_grow = std::min(element.flex_grow, block->flex_grow_y);
+    element.flex_shrink = g.blocks[line.begin].flex_shrink_y;
+    element.flex_grow = g.blocks[line.begin].flex_grow_y;
+    for (size_t i = line.begin; i < line.end; ++i) {
+      const Block& block = g.blocks[i];
+      element.min_size = std::max(element.min_size, block.min_size_y);
+      element.flex_shrink = std::min(element.flex_shrink, block.flex_shrink_y);
+      element.flex_grow = std::min(element.flex_grow, block.flex_grow_y);
     }
     elements.push_back(element);
   }
@@ -199,7 +217,8 @@ void SetY(Global& g, std::vector<Line> lines) {
   // [Align items]
   for (size_t i = 0; i < lines.size(); ++i) {
     auto& element = elements[i];
-    for (auto* block : lines[i].blocks) {
+    for (size_t j = lines[i].begin; j < lines[i].end; ++j) {
+      Block* block = &g.blocks[j];
       bool stretch =
           block->flex_grow_y != 0 ||
           g.config.align_content == FlexboxConfig::AlignContent::Stretch;
@@ -234,9 +253,12 @@ void SetY(Global& g, std::vector<Line> lines) {
   }
 }
 
-void JustifyContent(Global& g, std::vector<Line> lines) {
-  for (auto& line : lines) {
-    Block* last = line.blocks.back();
+// Distribute the remaining space, for the lines from |first_line|.
+void JustifyContent(Global& g, size_t first_line) {
+  for (size_t l = first_line; l < g.lines.size(); ++l) {
+    Block* first = &g.blocks[g.lines[l].begin];
+    const int size = int(g.lines[l].end - g.lines[l].begin);
+    Block* last = first + size - 1;
     int remaining_space = g.size_x - last->x - last->dim_x;
     switch (g.config.justify_content) {
       case FlexboxConfig::JustifyContent::FlexStart:
@@ -244,38 +266,38 @@ void JustifyContent(Global& g, std::vector<Line> lines) {
         break;
 
       case FlexboxConfig::JustifyContent::FlexEnd: {
-        for (auto* block : line.blocks) {
+        for (Block* block = first; block <= last; ++block) {
           block->x += remaining_space;
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::Center: {
-        for (auto* block : line.blocks) {
+        for (Block* block = first; block <= last; ++block) {
           block->x += remaining_space / 2;
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::SpaceBetween: {
-        for (int i = (int)line.blocks.size() - 1; i >= 1; --i) {
-          line.blocks[i]->x += remaining_space;
+        for (int i = size - 1; i >= 1; --i) {
+          first[i].x += remaining_space;
           remaining_space = remaining_space * (i - 1) / i;
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::SpaceAround: {
-        for (int i = (int)line.blocks.size() - 1; i >= 0; --i) {
-          line.blocks[i]->x += remaining_space * (2 * i + 1) / (2 * i + 2);
+        for (int i = size - 1; i >= 0; --i) {
+          first[i].x += remaining_space * (2 * i + 1) / (2 * i + 2);
           remaining_space = remaining_space * (2 * i) / (2 * i + 2);
         }
         break;
       }
 
       case FlexboxConfig::JustifyContent::SpaceEvenly: {
-        for (int i = (int)line.blocks.size() - 1; i >= 0; --i) {
-          line.blocks[i]->x += remaining_space * (i + 1) / (i + 2);
+        for (int i = size - 1; i >= 0; --i) {
+          first[i].x += remaining_space * (i + 1) / (i + 2);
           remaining_space = remaining_space * (i + 1) / (i + 2);
         }
         break;
@@ -312,51 +334,97 @@ void Compute2(Global& global) {
 }
 
 void Compute3(Global& global) {
-  // Step 1: Lay out every elements into rows:
-  std::vector<Line> lines;
+  std::vector<Line>& lines = global.lines;
+
+  // Step 1: Lay out every elements into rows. The block preceding the first
+  // modified one may now have a different successor on its row, so the rows
+  // are rebuilt from its own.
+  size_t first_line = 0;
+  if (global.first_modified != 0) {
+    first_line = global.blocks[global.first_modified - 1].line;
+  }
+  lines.resize(first_line);
   {
-    Line line;
+    size_t begin = lines.empty() ? 0 : lines.back().end;
     int x = 0;
-    for (auto& block : global.blocks) {
+    for (size_t i = begin; i < global.blocks.size(); ++i) {
+      Block& block = global.blocks[i];
       // Does it fit the end of the row?
       // No? Then we need to start a new one:
       if (x + block.min_size_x > global.size_x) {
         x = 0;
-        if (!line.blocks.empty()) {
-          lines.push_back(std::move(line));
+        if (i != begin) {
+          lines.push_back({begin, i});
+          begin = i;
         }
-        line = Line();
       }
 
       block.line = (int)lines.size();
-      block.line_position = (int)line.blocks.size();
-      line.blocks.push_back(&block);
+      block.line_position = int(i - begin);
       x += block.min_size_x + global.config.gap_x;
     }
-    if (!line.blocks.empty()) {
-      lines.push_back(std::move(line));
+    if (begin != global.blocks.size()) {
+      lines.push_back({begin, global.blocks.size()});
     }
   }
 
   // Step 2: Set positions on the X axis.
-  SetX(global, lines);
-  JustifyContent(global, lines);  // Distribute remaining space.
+  SetX(global, first_line);
+  JustifyContent(global, first_line);  // Distribute remaining space.
 
   // Step 3: Set positions on the Y axis.
-  SetY(global, lines);
+  SetY(global);
 }
 
 }  // namespace
 
-void Compute(Global& global) {
+void SetInput(Global& global, size_t index, const Block& input) {
+  Block& block = global.blocks[index];
+  if (SameInput(block, input)) {
+    return;
+  }
+  block.min_size_x = input.min_size_x;
+  block.min_size_y = input.min_size_y;
+  block.flex_grow_x = input.flex_grow_x;
+  block.flex_grow_y = input.flex_grow_y;
+  block.flex_shrink_x = input.flex_shrink_x;
+  block.flex_shrink_y = input.flex_shrink_y;
+  global.first_modified = std::min(global.first_modified, index);
+}
+
+bool Compute(Global& global) {
+  // The previous output can be reused only if it was computed in the same
+  // space, for the same blocks.
+  const size_t computed_blocks =
+      global.lines.empty() ? 0 : global.lines.back().end;
+  if (global.size_x != global.computed_size_x ||
+      global.size_y != global.computed_size_y ||
+      !SameConfig(global.config, global.computed_config) ||
+      computed_blocks != global.blocks.size()) {
+    global.first_modified = 0;
+  }
+
+  // Nothing changed.
+  if (global.first_modified >= global.blocks.size()) {
+    return false;
+  }
+
+  // The symmetries are involutions. Applied to the previous output, they
+  // restore the coordinates Compute3() produced, which it can resume from.
   if (global.config.direction == FlexboxConfig::Direction::Column ||
       global.config.direction == FlexboxConfig::Direction::ColumnInversed) {
     SymmetryXY(global);
     Compute1(global);
     SymmetryXY(global);
-    return;
+  } else {
+    Compute1(global);
   }
-  Compute1(global);
+
+  global.first_modified = global.blocks.size();
+  global.computed_config = global.config;
+  global.computed_size_x = global.size_x;
+  global.computed_size_y = global.size_y;
+  return true;
 }
 
 }  // namespace ftxui::flexbox_helper
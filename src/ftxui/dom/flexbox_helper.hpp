@@ -1,7 +1,9 @@
 #ifndef FTXUI_DOM_FLEXBOX_HELPER_HPP
 #define FTXUI_DOM_FLEXBOX_HELPER_HPP
 
-#include <vector>
+#include <cstddef>  // for size_t
+#include <vector>   // for vector
+
 #include "ftxui/dom/flexbox_config.hpp"
 
 namespace ftxui {
@@ -26,14 +28,37 @@ struct Block {
   bool overflow = false;
 };
 
+// The blocks in [begin, end) are laid out on the same line.
+struct Line {
+  size_t begin = 0;
+  size_t end = 0;
+};
+
 struct Global {
   std::vector<Block> blocks;
   FlexboxConfig config;
   int size_x;
   int size_y;
+
+  // The blocks before |first_modified| kept their input and their output since
+  // the previous Compute(). If the config and the sizes are also unchanged,
+  // only the lines from the one where they may differ are laid out again.
+  // Compute() sets it to blocks.size().
+  size_t first_modified = 0;
+
+  // The result of the previous Compute():
+  std::vector<Line> lines;
+  FlexboxConfig computed_config;
+  int computed_size_x = -1;
+  int computed_size_y = -1;
 };
 
-void Compute(Global& global);
+// Set the input of the |index|-th block. It is marked modified only if the
+// input changed.
+void SetInput(Global& global, size_t index, const Block& input);
+
+// Lay out the blocks. Returns false when the previous output was kept as is.
+bool Compute(Global& global);
 
 }  // namespace flexbox_helper
 }  // namespace ftxui
@@ -226,6 +226,56 @@ TEST(FlexboxHelperTest, BasicColumnInversed) {
   EXPECT_EQ(g.blocks[4].dim_y, 5);
 }
 
+TEST(FlexboxHelperTest, Incremental) {
+  for (auto direction : {
+           FlexboxConfig::Direction::Row,
+           FlexboxConfig::Direction::RowInversed,
+           FlexboxConfig::Direction::Column,
+           FlexboxConfig::Direction::ColumnInversed,
+       }) {
+    for (size_t modified = 0; modified < 8; ++modified) {
+      flexbox_helper::Global g;
+      g.config = FlexboxConfig()
+                     .Set(direction)
+                     .Set(FlexboxConfig::Wrap::WrapInversed)
+                     .Set(FlexboxConfig::JustifyContent::SpaceBetween)
+                     .SetGap(1, 1);
+      g.size_x = 20;
+      g.size_y = 20;
+      g.blocks.resize(8);
+      for (size_t i = 0; i < g.blocks.size(); ++i) {
+        flexbox_helper::Block block;
+        block.min_size_x = 2 + int(i) % 3;
+        block.min_size_y = 1 + int(i) % 2;
+        flexbox_helper::SetInput(g, i, block);
+      }
+      flexbox_helper::Compute(g);
+
+      flexbox_helper::Block block;
+      block.min_size_x = 1;
+      block.min_size_y = 3;
+      flexbox_helper::SetInput(g, modified, block);
+      EXPECT_EQ(g.first_modified, modified);
+      flexbox_helper::Compute(g);
+
+      flexbox_helper::Global expected;
+      expected.config = g.config;
+      expected.size_x = g.size_x;
+      expected.size_y = g.size_y;
+      expected.blocks = g.blocks;
+      flexbox_helper::Compute(expected);
+
+      for (size_t i = 0; i < g.blocks.size(); ++i) {
+        EXPECT_EQ(g.blocks[i].line, expected.blocks[i].line);
+        EXPECT_EQ(g.blocks[i].x, expected.blocks[i].x);
+        EXPECT_EQ(g.blocks[i].y, expected.blocks[i].y);
+        EXPECT_EQ(g.blocks[i].dim_x, expected.blocks[i].dim_x);
+        EXPECT_EQ(g.blocks[i].dim_y, expected.blocks[i].dim_y);
+      }
+    }
+  }
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
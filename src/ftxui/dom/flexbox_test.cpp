@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <memory>  // for make_shared
 #include <string>  // for allocator
 
 #include "ftxui/dom/elements.hpp"        // for text, flexbox
@@ -453,6 +454,51 @@ TEST(FlexboxTest, Focus) {
             "-");
 }
 
+TEST(FlexboxTest, ConvergedSiblingsAreNotLaidOutAgain) {
+  class Counter : public Node {
+   public:
+    explicit Counter(int* count) : count_(count) {}
+    void ComputeRequirement() override {
+      ++*count_;
+      requirement_.min_x = 1;
+      requirement_.min_y = 1;
+    }
+
+   private:
+    int* count_;
+  };
+
+  int count = 0;
+  auto document = hbox({
+      std::make_shared<Counter>(&count),
+      hflow({text("aaa"), text("bbb"), text("ccc")}),
+  });
+
+  Screen screen(7, 2);
+  Node::Status status;
+  Render(screen, document.get(), &status);
+  EXPECT_GT(status.iteration, 1);
+  EXPECT_FALSE(status.need_iteration);
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(screen.ToString(),
+            " aaabbb\r\n"
+            " ccc   ");
+}
+
+TEST(FlexboxTest, ClippedConverges) {
+  auto document = hflow({text("aaa"), text("bbb"), text("ccc")});
+  Screen screen(3, 2);
+  Node::Status status;
+  for (int i = 0; i < 2; ++i) {
+    Render(screen, document.get(), &status);
+    EXPECT_LT(status.iteration, 3);
+    EXPECT_FALSE(status.need_iteration);
+    EXPECT_EQ(screen.ToString(),
+              "aaa\r\n"
+              "bbb");
+  }
+}
+
 }  // namespace ftxui
 
 // Copyright 2021 Arthur Sonzogni. All rights reserved.
@@ -31,7 +31,7 @@ class Select : public Node {
 
   void SetBox(Box box) override {
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfNeeded(box);
   }
 };
 
@@ -43,7 +43,10 @@ Element select(Element child) {
 
 class Focus : public Select {
  public:
-  using Select::Select;
+  explicit Focus(Elements children) : Select(std::move(children)) {
+    // Moves the cursor of the Screen.
+    concurrent_render_ = false;
+  }
 
   void ComputeRequirement() override {
     Select::ComputeRequirement();
@@ -85,7 +88,10 @@ Element focus(Element child) {
 class Frame : public Node {
  public:
   Frame(Elements children, bool x_frame, bool y_frame)
-      : Node(std::move(children)), x_frame_(x_frame), y_frame_(y_frame) {}
+      : Node(std::move(children)), x_frame_(x_frame), y_frame_(y_frame) {
+    // Modifies the stencil of the Screen.
+    concurrent_render_ = false;
+  }
 
   void ComputeRequirement() override {
     Node::ComputeRequirement();
@@ -117,7 +123,7 @@ class Frame : public Node {
       children_box.y_max = box.y_min + internal_dimy - dy;
     }
 
-    children_[0]->SetBox(children_box);
+    children_[0]->SetBoxIfNeeded(children_box);
   }
 
   void Render(Screen& screen) override {
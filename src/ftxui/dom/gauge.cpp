@@ -49,9 +49,7 @@ class Gauge : public Node {
     if (!(progress_ < 1.F)) {
       progress_ = 1.F;
     }
-  }
 
-  void ComputeRequirement() override {
     switch (direction_) {
       case GaugeDirection::Right:
       case GaugeDirection::Left:
@@ -70,6 +68,7 @@ class Gauge : public Node {
     }
     requirement_.min_x = 1;
     requirement_.min_y = 1;
+    requirement_final_ = true;
   }
 
   void Render(Screen& screen) override {
@@ -4,11 +4,12 @@
 #include <utility>     // for move
 #include <vector>      // for vector
 
-#include "ftxui/dom/elements.hpp"     // for GraphFunction, Element, graph
-#include "ftxui/dom/node.hpp"         // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/dom/elements.hpp"      // for GraphFunction, Element, graph
+#include "ftxui/dom/graph_source.hpp"  // for GraphSource
+#include "ftxui/dom/node.hpp"          // for Node
+#include "ftxui/dom/requirement.hpp"   // for Requirement
+#include "ftxui/screen/box.hpp"        // for Box
+#include "ftxui/screen/screen.hpp"     // for Screen
 
 namespace ftxui {
 
@@ -22,47 +23,85 @@ static std::string charset[] =
     {" ", "▗", "▐", "▖", "▄", "▟", "▌", "▙", "█"};
 #endif
 
+namespace {
+
+// Draw |data|, two columns per cell, into |box|.
+void RenderGraph(Screen& screen, const Box& box, const std::vector<int>& data) {
+  int i = 0;
+  for (int x = box.x_min; x <= box.x_max; ++x) {
+    int height_1 = 2 * box.y_max - data[i++];
+    int height_2 = 2 * box.y_max - data[i++];
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      int yy = 2 * y;
+      int i_1 = yy < height_1 ? 0 : yy == height_1 ? 3 : 6;  // NOLINT
+      int i_2 = yy < height_2 ? 0 : yy == height_2 ? 1 : 2;  // NOLINT
+      screen.at(x, y) = charset[i_1 + i_2];                  // NOLINT
+    }
+  }
+}
+
+void SetGraphRequirement(Requirement& requirement) {
+  requirement.flex_grow_x = 1;
+  requirement.flex_grow_y = 1;
+  requirement.flex_shrink_x = 1;
+  requirement.flex_shrink_y = 1;
+  requirement.min_x = 3;
+  requirement.min_y = 3;
+}
+
+}  // namespace
+
 class Graph : public Node {
  public:
   explicit Graph(GraphFunction graph_function)
-      : graph_function_(std::move(graph_function)) {}
-
-  void ComputeRequirement() override {
-    requirement_.flex_grow_x = 1;
-    requirement_.flex_grow_y = 1;
-    requirement_.flex_shrink_x = 1;
-    requirement_.flex_shrink_y = 1;
-    requirement_.min_x = 3;
-    requirement_.min_y = 3;
+      : graph_function_(std::move(graph_function)) {
+    SetGraphRequirement(requirement_);
+    requirement_final_ = true;
   }
 
   void Render(Screen& screen) override {
     int width = (box_.x_max - box_.x_min + 1) * 2;
     int height = (box_.y_max - box_.y_min + 1) * 2;
-    auto data = graph_function_(width, height);
-    int i = 0;
-    for (int x = box_.x_min; x <= box_.x_max; ++x) {
-      int height_1 = 2 * box_.y_max - data[i++];
-      int height_2 = 2 * box_.y_max - data[i++];
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        int yy = 2 * y;
-        int i_1 = yy < height_1 ? 0 : yy == height_1 ? 3 : 6;  // NOLINT
-        int i_2 = yy < height_2 ? 0 : yy == height_2 ? 1 : 2;  // NOLINT
-        screen.at(x, y) = charset[i_1 + i_2];                  // NOLINT
-      }
-    }
+    RenderGraph(screen, box_, graph_function_(width, height));
   }
 
  private:
   GraphFunction graph_function_;
 };
 
+class GraphStream : public Node {
+ public:
+  explicit GraphStream(std::shared_ptr<GraphSource> source)
+      : source_(std::move(source)) {
+    SetGraphRequirement(requirement_);
+    requirement_final_ = true;
+    // The source is consumed while rendering.
+    concurrent_render_ = false;
+  }
+
+  void Render(Screen& screen) override {
+    int width = (box_.x_max - box_.x_min + 1) * 2;
+    int height = (box_.y_max - box_.y_min + 1) * 2;
+    RenderGraph(screen, box_, source_->Heights(width, height));
+  }
+
+ private:
+  std::shared_ptr<GraphSource> source_;
+};
+
 /// @brief Draw a graph using a GraphFunction.
 /// @param graph_function the function to be called to get the data.
 Element graph(GraphFunction graph_function) {
   return std::make_shared<Graph>(std::move(graph_function));
 }
 
+/// @brief Draw a graph of the samples pushed into a GraphSource. Only the
+/// samples received since the previous frame are processed.
+/// @param source the samples to be displayed.
+Element graph(std::shared_ptr<GraphSource> source) {
+  return std::make_shared<GraphStream>(std::move(source));
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
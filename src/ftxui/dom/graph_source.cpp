@@ -0,0 +1,181 @@
+#include "ftxui/dom/graph_source.hpp"
+
+#include <algorithm>  // for max, min
+#include <atomic>     // for memory_order_acquire, memory_order_release, ...
+#include <cmath>      // for lround
+#include <cstring>    // for memcpy
+
+namespace ftxui {
+
+namespace {
+
+// The number of columns kept, enough for the widest terminals.
+constexpr size_t kMaxColumns = 4096;
+
+uint32_t Sequence(uint64_t index) {
+  return uint32_t(index + 1);
+}
+
+uint64_t Pack(uint32_t sequence, float value) {
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return (uint64_t(sequence) << 32U) | bits;  // NOLINT
+}
+
+uint32_t UnpackSequence(uint64_t word) {
+  return uint32_t(word >> 32U);  // NOLINT
+}
+
+float UnpackValue(uint64_t word) {
+  const auto bits = uint32_t(word);
+  float value = 0.F;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// Compare two sequences. They are at most a few laps of the ring apart, much
+// less than 2^31.
+int32_t Compare(uint32_t a, uint32_t b) {
+  return int32_t(a - b);
+}
+
+uint64_t RoundUpToPowerOfTwo(size_t value) {
+  uint64_t out = 1;
+  while (out < value) {
+    out <<= 1U;
+  }
+  return out;
+}
+
+}  // namespace
+
+/// @brief Constructor.
+/// @param samples_per_column the number of samples reduced into one column.
+/// @param decimation the function reducing the samples of a column.
+/// @param capacity the number of samples buffered between two renders. It is
+///        rounded up to a power of two.
+GraphSource::GraphSource(int samples_per_column,
+                         Decimation decimation,
+                         size_t capacity)
+    : mask_(RoundUpToPowerOfTwo(std::max(capacity, size_t(1))) - 1),
+      samples_per_column_(std::max(samples_per_column, 1)),
+      decimation_(decimation) {
+  slots_ = std::make_unique<Slot[]>(mask_ + 1);  // NOLINT
+}
+
+GraphSource::~GraphSource() = default;
+
+/// @brief Add a sample. This is lock-free, and can be called concurrently from
+/// any thread.
+void GraphSource::Push(float value) {
+  const uint64_t index = head_.fetch_add(1, std::memory_order_relaxed);
+  Slot& slot = slots_[index & mask_];
+  const uint32_t sequence = Sequence(index);
+  const uint64_t word = Pack(sequence, value);
+
+  // Claim the slot, unless a producer a lap ahead already wrote its newer
+  // sample there. This one is then dropped, like any overwritten sample.
+  uint64_t current = slot.word.load(std::memory_order_relaxed);
+  while (Compare(UnpackSequence(current), sequence) < 0) {
+    if (slot.word.compare_exchange_weak(current, word,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+      return;
+    }
+  }
+}
+
+/// @brief Set the range of values displayed by the graph. By default, the
+/// range is adjusted to the displayed columns.
+void GraphSource::SetRange(float min, float max) {
+  range_min_ = min;
+  range_max_ = max;
+}
+
+/// @brief Consume the samples published since the last call.
+void GraphSource::Drain() {
+  const uint64_t head = head_.load(std::memory_order_acquire);
+  if (head - tail_ > mask_ + 1) {
+    tail_ = head - (mask_ + 1);
+  }
+  for (; tail_ < head; ++tail_) {
+    const uint64_t word =
+        slots_[tail_ & mask_].word.load(std::memory_order_acquire);
+    const int32_t order = Compare(UnpackSequence(word), Sequence(tail_));
+    if (order < 0) {
+      return;  // Still being written. Resume from here next time.
+    }
+    if (order > 0) {
+      continue;  // Overwritten by a newer sample.
+    }
+    Add(UnpackValue(word));
+  }
+}
+
+void GraphSource::Add(float value) {
+  if (current_.count == 0) {
+    current_.min = value;
+    current_.max = value;
+  }
+  current_.min = std::min(current_.min, value);
+  current_.max = std::max(current_.max, value);
+  current_.sum += value;
+  current_.count++;
+  if (current_.count < samples_per_column_) {
+    return;
+  }
+
+  columns_.push_back(current_);
+  current_ = Column();
+  if (columns_.size() > kMaxColumns) {
+    columns_.pop_front();
+  }
+}
+
+/// @brief The graph data: the height of the |width| most recent columns,
+/// between 0 and |height|. Missing columns are -1. Only the samples received
+/// since the previous call are processed.
+const std::vector<int>& GraphSource::Heights(int width, int height) {
+  Drain();
+
+  auto value = [&](const Column& column) {
+    switch (decimation_) {
+      case Decimation::Min:
+        return column.min;
+      case Decimation::Max:
+        return column.max;
+      case Decimation::Mean:
+        break;
+    }
+    return column.sum / float(column.count);
+  };
+
+  width = std::max(width, 0);
+  const int available = std::min(width, (int)columns_.size());
+  const auto first = columns_.end() - available;
+
+  float min = range_min_;
+  float max = range_max_;
+  if (min >= max && available != 0) {
+    min = value(*first);
+    max = min;
+    for (auto it = first; it != columns_.end(); ++it) {
+      min = std::min(min, value(*it));
+      max = std::max(max, value(*it));
+    }
+  }
+
+  heights_.assign(width - available, -1);
+  for (auto it = first; it != columns_.end(); ++it) {
+    const float ratio = max > min ? (value(*it) - min) / (max - min) : 0.F;
+    const int h = int(std::lround(ratio * float(height)));
+    heights_.push_back(std::max(0, std::min(height, h)));
+  }
+  return heights_;
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <atomic>  // for atomic
+#include <memory>  // for make_shared
+#include <thread>  // for thread
+#include <vector>  // for vector
+
+#include "ftxui/dom/elements.hpp"      // for graph
+#include "ftxui/dom/graph_source.hpp"  // for GraphSource
+#include "ftxui/dom/node.hpp"          // for Render
+#include "ftxui/screen/screen.hpp"     // for Screen
+
+namespace ftxui {
+
+TEST(GraphSourceTest, Empty) {
+  GraphSource source;
+  EXPECT_EQ(source.Heights(4, 10), std::vector<int>({-1, -1, -1, -1}));
+}
+
+TEST(GraphSourceTest, Decimation) {
+  GraphSource mean(2, GraphSource::Decimation::Mean);
+  GraphSource min(2, GraphSource::Decimation::Min);
+  GraphSource max(2, GraphSource::Decimation::Max);
+  for (float value : {0, 10, 2, 4, 6, 6, 1}) {
+    mean.Push(value);
+    min.Push(value);
+    max.Push(value);
+  }
+  mean.SetRange(0, 10);
+  min.SetRange(0, 10);
+  max.SetRange(0, 10);
+
+  // The last sample doesn't complete a column yet.
+  EXPECT_EQ(mean.Heights(4, 10), std::vector<int>({-1, 5, 3, 6}));
+  EXPECT_EQ(min.Heights(4, 10), std::vector<int>({-1, 0, 2, 6}));
+  EXPECT_EQ(max.Heights(4, 10), std::vector<int>({-1, 10, 4, 6}));
+
+  mean.Push(9);
+  EXPECT_EQ(mean.Heights(4, 10), std::vector<int>({5, 3, 6, 5}));
+}
+
+TEST(GraphSourceTest, AutoRange) {
+  GraphSource source;
+  for (float value : {-3, 1, 5}) {
+    source.Push(value);
+  }
+  EXPECT_EQ(source.Heights(3, 8), std::vector<int>({0, 4, 8}));
+  EXPECT_EQ(source.Heights(2, 8), std::vector<int>({0, 8}));
+}
+
+TEST(GraphSourceTest, Overflow) {
+  GraphSource source(1, GraphSource::Decimation::Mean, 4);
+  for (int i = 0; i < 10; ++i) {
+    source.Push(float(i));
+  }
+  source.SetRange(0, 10);
+  EXPECT_EQ(source.Heights(6, 10), std::vector<int>({-1, -1, 6, 7, 8, 9}));
+}
+
+TEST(GraphSourceTest, ConcurrentProducers) {
+  const int samples = 10000;
+  GraphSource source(1, GraphSource::Decimation::Mean, 4 * samples);
+  source.SetRange(0, 2);
+  std::vector<std::thread> producers;
+  for (int i = 0; i < 4; ++i) {
+    producers.emplace_back([&] {
+      for (int j = 0; j < samples; ++j) {
+        source.Push(1.F);
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  const auto& heights = source.Heights(4 * samples, 2);
+  EXPECT_EQ(heights.size(), size_t(4 * samples));
+  int columns = 0;
+  for (int height : heights) {
+    if (height != -1) {
+      EXPECT_EQ(height, 1);
+      columns++;
+    }
+  }
+  // At most 4096 columns are kept.
+  EXPECT_EQ(columns, 4096);
+}
+
+// The producers lap the ring while it is drained. The samples kept from each
+// producer must stay in order.
+TEST(GraphSourceTest, ConcurrentOverflow) {
+  const int producers = 4;
+  const int samples = 20000;
+  const int range = producers * samples;
+  GraphSource source(1, GraphSource::Decimation::Mean, 16);
+  source.SetRange(0, float(range));
+
+  std::atomic<int> running = producers;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < producers; ++i) {
+    threads.emplace_back([&, i] {
+      for (int j = 0; j < samples; ++j) {
+        source.Push(float(i * samples + j));
+      }
+      running--;
+    });
+  }
+
+  auto check = [&] {
+    std::vector<int> last(producers, -1);
+    for (int height : source.Heights(4096, range)) {
+      if (height == -1) {
+        continue;
+      }
+      const int producer = height / samples;
+      ASSERT_LT(producer, producers);
+      EXPECT_GT(height, last[producer]);
+      last[producer] = height;
+    }
+  };
+  while (running) {
+    check();
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  check();
+}
+
+TEST(GraphSourceTest, Render) {
+  auto source = std::make_shared<GraphSource>();
+  source->SetRange(0, 4);
+  for (float value : {0, 1, 2, 3, 4, 4}) {
+    source->Push(value);
+  }
+  Screen screen(3, 2);
+  Render(screen, graph(source));
+  EXPECT_EQ(screen.ToString(), " ▟█\r\n▟██");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,152 +1,153 @@
 #include <algorithm>  // for max, min
 #include <cstddef>    // for size_t
 #include <memory>  // for __shared_ptr_access, shared_ptr, make_shared, allocator_traits<>::value_type
-#include <utility>  // for move
-#include <vector>   // for vector, __alloc_traits<>::value_type
+#include <vector>  // for vector, __alloc_traits<>::value_type
 
 #include "ftxui/dom/box_helper.hpp"   // for Element, Compute
-#include "ftxui/dom/elements.hpp"     // for Elements, filler, Element, gridbox
+#include "ftxui/dom/elements.hpp"     // for Elements, Element, gridbox
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/parallel.hpp"  // for For
 
 namespace ftxui {
 class Screen;
 
 namespace {
 
-// Accumulate the values of a list U[n] into v[n]. So that:
-// V[0] = 0;
-// V[n+1] = v[n] + U[n]
-// return the sum of U[n].
-int Integrate(std::vector<int>& elements) {
-  int accu = 0;
-  for (auto& i : elements) {
-    int old_accu = accu;
-    accu += i;
-    i = old_accu;
+// The size of a column or row, as if every row was filled with `filler()`.
+box_helper::Element Init() {
+  box_helper::Element init;
+  init.min_size = 0;
+  init.flex_grow = 1024;    // NOLINT
+  init.flex_shrink = 1024;  // NOLINT
+  return init;
+}
+
+// A missing cell behaves like `filler()`.
+void AddFiller(box_helper::Element& element) {
+  element.flex_grow = std::min(element.flex_grow, 1);
+  element.flex_shrink = std::min(element.flex_shrink, 1);
+}
+
+Elements Flatten(const std::vector<Elements>& lines) {
+  Elements cells;
+  for (const auto& line : lines) {
+    cells.insert(cells.end(), line.begin(), line.end());
   }
-  return accu;
+  return cells;
 }
+
 }  // namespace
 
+// The cells are the children, row by row. Rows may be shorter than others.
 class GridBox : public Node {
  public:
-  explicit GridBox(std::vector<Elements> lines) : lines_(std::move(lines)) {
-    y_size = (int)lines_.size();
-    for (const auto& line : lines_) {
-      x_size = std::max(x_size, (int)line.size());
-    }
-    for (auto& line : lines_) {
-      while (line.size() < (size_t)x_size) {
-        line.push_back(filler());
-      }
+  explicit GridBox(const std::vector<Elements>& lines)
+      : Node(Flatten(lines)), row_begin_(lines.size() + 1, 0) {
+    y_size = (int)lines.size();
+    for (int y = 0; y < y_size; ++y) {
+      x_size = std::max(x_size, (int)lines[y].size());
+      row_begin_[y + 1] = row_begin_[y] + (int)lines[y].size();
     }
   }
 
   void ComputeRequirement() override {
-    requirement_.min_x = 0;
-    requirement_.min_y = 0;
-    requirement_.flex_grow_x = 0;
-    requirement_.flex_grow_y = 0;
-    requirement_.flex_shrink_x = 0;
-    requirement_.flex_shrink_y = 0;
-
-    for (auto& line : lines_) {
-      for (auto& cell : line) {
-        cell->ComputeRequirement();
+    Node::ComputeRequirement();
+    requirement_ = Requirement();
+
+    // Compute the size of each column and row, in a single pass. They are kept
+    // for SetBox().
+    columns_.assign(x_size, Init());
+    rows_.assign(y_size, Init());
+    int selected_x = 0;
+    int selected_y = 0;
+    for (int y = 0; y < y_size; ++y) {
+      auto& row = rows_[y];
+      const int row_size = row_begin_[y + 1] - row_begin_[y];
+      for (int x = 0; x < row_size; ++x) {
+        const Requirement& r = children_[row_begin_[y] + x]->requirement();
+        auto& column = columns_[x];
+        column.min_size = std::max(column.min_size, r.min_x);
+        row.min_size = std::max(row.min_size, r.min_y);
+        column.flex_grow = std::min(column.flex_grow, r.flex_grow_x);
+        row.flex_grow = std::min(row.flex_grow, r.flex_grow_y);
+        column.flex_shrink = std::min(column.flex_shrink, r.flex_shrink_x);
+        row.flex_shrink = std::min(row.flex_shrink, r.flex_shrink_y);
+
+        // Forward the selected/focused child state. Among equals, the leftmost
+        // one, then the topmost one wins.
+        if (r.selection > requirement_.selection ||
+            (r.selection == requirement_.selection &&
+             r.selection != Requirement::NORMAL && x < selected_x)) {
+          requirement_.selection = r.selection;
+          requirement_.selected_box = r.selected_box;
+          selected_x = x;
+          selected_y = y;
+        }
       }
-    }
-
-    // Compute the size of each columns/row.
-    std::vector<int> size_x(x_size, 0);
-    std::vector<int> size_y(y_size, 0);
-    for (int x = 0; x < x_size; ++x) {
-      for (int y = 0; y < y_size; ++y) {
-        size_x[x] = std::max(size_x[x], lines_[y][x]->requirement().min_x);
-        size_y[y] = std::max(size_y[y], lines_[y][x]->requirement().min_y);
+      for (int x = row_size; x < x_size; ++x) {
+        AddFiller(columns_[x]);
+        AddFiller(row);
       }
     }
 
-    requirement_.min_x = Integrate(size_x);
-    requirement_.min_y = Integrate(size_y);
-
-    // Forward the selected/focused child state:
-    requirement_.selection = Requirement::NORMAL;
+    int offset_x = 0;
+    int offset_y = 0;
     for (int x = 0; x < x_size; ++x) {
-      for (int y = 0; y < y_size; ++y) {
-        if (requirement_.selection >= lines_[y][x]->requirement().selection) {
-          continue;
-        }
-        requirement_.selection = lines_[y][x]->requirement().selection;
-        requirement_.selected_box = lines_[y][x]->requirement().selected_box;
-        requirement_.selected_box.x_min += size_x[x];
-        requirement_.selected_box.x_max += size_x[x];
-        requirement_.selected_box.y_min += size_y[y];
-        requirement_.selected_box.y_max += size_y[y];
-      }
+      offset_x += x < selected_x ? columns_[x].min_size : 0;
+      requirement_.min_x += columns_[x].min_size;
+    }
+    for (int y = 0; y < y_size; ++y) {
+      offset_y += y < selected_y ? rows_[y].min_size : 0;
+      requirement_.min_y += rows_[y].min_size;
     }
+    requirement_.selected_box.x_min += offset_x;
+    requirement_.selected_box.x_max += offset_x;
+    requirement_.selected_box.y_min += offset_y;
+    requirement_.selected_box.y_max += offset_y;
   }
 
   void SetBox(Box box) override {
     Node::SetBox(box);
 
-    box_helper::Element init;
-    init.min_size = 0;
-    init.flex_grow = 1024;    // NOLINT
-    init.flex_shrink = 1024;  // NOLINT
-    std::vector<box_helper::Element> elements_x(x_size, init);
-    std::vector<box_helper::Element> elements_y(y_size, init);
-
-    for (int y = 0; y < y_size; ++y) {
-      for (int x = 0; x < x_size; ++x) {
-        const auto& cell = lines_[y][x];
-        const auto& requirement = cell->requirement();
-        auto& e_x = elements_x[x];
-        auto& e_y = elements_y[y];
-        e_x.min_size = std::max(e_x.min_size, requirement.min_x);
-        e_y.min_size = std::max(e_y.min_size, requirement.min_y);
-        e_x.flex_grow = std::min(e_x.flex_grow, requirement.flex_grow_x);
-        e_y.flex_grow = std::min(e_y.flex_grow, requirement.flex_grow_y);
-        e_x.flex_shrink = std::min(e_x.flex_shrink, requirement.flex_shrink_x);
-        e_y.flex_shrink = std::min(e_y.flex_shrink, requirement.flex_shrink_y);
-      }
-    }
-
+    std::vector<box_helper::Element> elements_x = columns_;
+    std::vector<box_helper::Element> elements_y = rows_;
     int target_size_x = box.x_max - box.x_min + 1;
     int target_size_y = box.y_max - box.y_min + 1;
     box_helper::Compute(&elements_x, target_size_x);
     box_helper::Compute(&elements_y, target_size_y);
 
-    Box box_y = box;
-    int y = box_y.y_min;
+    // Position of each column and row:
+    std::vector<int> x_min(x_size + 1, box.x_min);
+    std::vector<int> y_min(y_size + 1, box.y_min);
+    for (int ix = 0; ix < x_size; ++ix) {
+      x_min[ix + 1] = x_min[ix] + elements_x[ix].size;
+    }
     for (int iy = 0; iy < y_size; ++iy) {
-      box_y.y_min = y;
-      y += elements_y[iy].size;
-      box_y.y_max = y - 1;
-
-      Box box_x = box_y;
-      int x = box_x.x_min;
-      for (int ix = 0; ix < x_size; ++ix) {
-        box_x.x_min = x;
-        x += elements_x[ix].size;
-        box_x.x_max = x - 1;
-        lines_[iy][ix]->SetBox(box_x);
-      }
+      y_min[iy + 1] = y_min[iy] + elements_y[iy].size;
     }
-  }
 
-  void Render(Screen& screen) override {
-    for (auto& line : lines_) {
-      for (auto& cell : line) {
-        cell->Render(screen);
+    parallel::For(y_size, [&](size_t iy) {
+      Box box_x;
+      box_x.y_min = y_min[iy];
+      box_x.y_max = y_min[iy + 1] - 1;
+      for (int i = row_begin_[iy]; i < row_begin_[iy + 1]; ++i) {
+        const int ix = i - row_begin_[iy];
+        box_x.x_min = x_min[ix];
+        box_x.x_max = x_min[ix + 1] - 1;
+        children_[i]->SetBoxIfNeeded(box_x);
       }
-    }
+    });
   }
 
   int x_size = 0;
   int y_size = 0;
-  std::vector<Elements> lines_;
+
+ private:
+  std::vector<int> row_begin_;  // The index of the first cell of each row.
+  std::vector<box_helper::Element> columns_;
+  std::vector<box_helper::Element> rows_;
 };
 
 /// @brief A container displaying a grid of elements.
@@ -176,7 +177,7 @@ class GridBox : public Node {
 ///╰──────────╯╰──────╯╰──────────╯
 /// ```
 Element gridbox(std::vector<Elements> lines) {
-  return std::make_shared<GridBox>(std::move(lines));
+  return std::make_shared<GridBox>(lines);
 }
 
 }  // namespace ftxui
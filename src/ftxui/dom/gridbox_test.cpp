@@ -5,8 +5,9 @@
 #include <string>     // for allocator, basic_string, string
 #include <vector>     // for vector
 
-#include "ftxui/dom/elements.hpp"  // for text, operator|, Element, flex, Elements, flex_grow, flex_shrink, vtext, gridbox, vbox, focus, operator|=, border, frame
-#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/dom/elements.hpp"  // for text, operator|, Element, flex, Elements, flex_grow, flex_shrink, vtext, gridbox, vbox, focus, operator|=, border, frame, filler
+#include "ftxui/dom/node.hpp"      // for Render, SetParallelLayout
+#include "ftxui/screen/color.hpp"   // for Color, Color::Blue
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 namespace ftxui {
@@ -595,6 +596,42 @@ TEST(GridboxTest, MissingCells) {
             "                    ");
 }
 
+TEST(GridboxTest, MissingCellsAreFillers) {
+  auto ragged = gridbox({
+      {cell("1") | flex, cell("2")},
+      {cell("3")},
+      {},
+  });
+  auto filled = gridbox({
+      {cell("1") | flex, cell("2")},
+      {cell("3"), filler()},
+      {filler(), filler()},
+  });
+
+  Screen screen_ragged(10, 8);
+  Render(screen_ragged, ragged);
+  Screen screen_filled(10, 8);
+  Render(screen_filled, filled);
+  EXPECT_EQ(screen_ragged.ToString(), screen_filled.ToString());
+}
+
+TEST(GridboxTest, FocusLeftmost) {
+  auto root = gridbox({
+      {cell("1"), cell("2") | focus},
+      {cell("3") | focus, cell("4")},
+      {cell("5"), cell("6")},
+  });
+
+  root |= frame;
+
+  Screen screen(3, 3);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "╭─╮\r\n"
+            "│3│\r\n"
+            "╰─╯");
+}
+
 TEST(GridboxTest, Focus) {
   auto root = gridbox({
       {cell("1"), cell("2"), cell("3"), cell("4")},
@@ -614,6 +651,38 @@ TEST(GridboxTest, Focus) {
             "╰──╯");
 }
 
+TEST(GridboxTest, ParallelLayout) {
+  auto make = [] {
+    std::vector<Elements> lines;
+    for (int y = 0; y < 64; ++y) {
+      Elements line;
+      for (int x = 0; x < 40; ++x) {
+        auto cell = text(std::to_string((x + y) % 10));
+        if ((x + y) % 3 == 0) {
+          cell |= bgcolor(Color::Blue);
+        }
+        line.push_back(cell);
+      }
+      lines.push_back(line);
+    }
+    Elements column;
+    for (int y = 0; y < 64; ++y) {
+      column.push_back(hflow({text("a"), text("bb") | bold, text("c")}));
+    }
+    return hbox({gridbox(lines), separator(), vbox(column) | frame});
+  };
+
+  Screen sequential(60, 70);
+  Render(sequential, make());
+
+  SetParallelLayout(3);
+  Screen parallel(60, 70);
+  Render(parallel, make());
+  SetParallelLayout(0);
+
+  EXPECT_EQ(sequential.ToString(), parallel.ToString());
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -356,6 +356,20 @@ TEST(HBoxTest, FlexGrow_NoFlex_FlewShrink) {
   }
 }
 
+TEST(HBoxTest, FinalRequirement) {
+  auto leaves = hbox({text("a"), separator(), text("bc")});
+  auto decorated = hbox({text("a"), text("bc") | flex});
+  leaves->ComputeRequirement();
+  decorated->ComputeRequirement();
+  EXPECT_TRUE(leaves->requirement_final());
+  EXPECT_FALSE(decorated->requirement_final());
+  EXPECT_EQ(leaves->requirement().min_x, 4);
+
+  Screen screen(4, 1);
+  Render(screen, hbox({leaves}));
+  EXPECT_EQ(screen.ToString(), "a│bc");
+}
+
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
@@ -1,21 +1,27 @@
 #include <ftxui/screen/box.hpp>  // for Box
+#include <cstddef>               // for size_t
 #include <utility>               // for move
 
 #include "ftxui/dom/node.hpp"
-#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/screen/parallel.hpp"  // for For
+#include "ftxui/screen/screen.hpp"    // for Screen
 
 namespace ftxui {
 
 Node::Node() = default;
-Node::Node(Elements children) : children_(std::move(children)) {}
+Node::Node(Elements children) : children_(std::move(children)) {
+  for (auto& child : children_) {
+    concurrent_render_ &= child->concurrent_render();
+  }
+}
 Node::~Node() = default;
 
 /// @brief Compute how much space an elements needs.
 /// @ingroup dom
 void Node::ComputeRequirement() {
-  for (auto& child : children_) {
-    child->ComputeRequirement();
-  }
+  parallel::For(children_.size(), [&](size_t i) {
+    children_[i]->ComputeRequirementIfNeeded();
+  });
 }
 
 /// @brief Assign a position and a dimension to an element for drawing.
@@ -27,18 +33,47 @@ void Node::SetBox(Box box) {
 /// @brief Display an element on a ftxui::Screen.
 /// @ingroup dom
 void Node::Render(Screen& screen) {
-  for (auto& child : children_) {
-    child->Render(screen);
-  }
+  parallel::For(
+      children_.size(), [&](size_t i) { children_[i]->Render(screen); },
+      concurrent_render_);
 }
 
 void Node::Check(Status* status) {
   for (auto& child : children_) {
-    child->Check(status);
+    child->CheckLayout(status);
   }
   status->need_iteration |= (status->iteration == 0);
 }
 
+/// @brief Call Check() and remember whether this subtree asked for another
+/// layout iteration.
+/// @ingroup dom
+void Node::CheckLayout(Status* status) {
+  const bool need_iteration = status->need_iteration;
+  status->need_iteration = false;
+  Check(status);
+  need_layout_ = status->need_iteration || status->iteration == 0;
+  status->need_iteration |= need_iteration;
+}
+
+/// @brief Compute the requirement, unless this subtree already converged.
+/// @ingroup dom
+void Node::ComputeRequirementIfNeeded() {
+  if (need_layout_ && !requirement_final_) {
+    ComputeRequirement();
+  }
+}
+
+/// @brief Assign a box, unless this subtree already converged and the box is
+/// unchanged.
+/// @ingroup dom
+void Node::SetBoxIfNeeded(Box box) {
+  if (!need_layout_ && box == box_) {
+    return;
+  }
+  SetBox(box);
+}
+
 /// @brief Display an element on a ftxui::Screen.
 /// @ingroup dom
 void Render(Screen& screen, const Element& element) {
@@ -48,26 +83,36 @@ void Render(Screen& screen, const Element& element) {
 /// @brief Display an element on a ftxui::Screen.
 /// @ingroup dom
 void Render(Screen& screen, Node* node) {
+  Node::Status status;
+  Render(screen, node, &status);
+}
+
+/// @brief Display an element on a ftxui::Screen.
+/// @param status Receives the number of layout iterations, and whether the
+///               layout converged.
+/// @ingroup dom
+void Render(Screen& screen, Node* node, Node::Status* status) {
   Box box;
   box.x_min = 0;
   box.y_min = 0;
   box.x_max = screen.dimx() - 1;
   box.y_max = screen.dimy() - 1;
 
-  Node::Status status;
-  node->Check(&status);
+  *status = Node::Status();
+  node->CheckLayout(status);
   const int max_iterations = 20;
-  while (status.need_iteration && status.iteration < max_iterations) {
-    // Step 1: Find what dimension this elements wants to be.
-    node->ComputeRequirement();
+  while (status->need_iteration && status->iteration < max_iterations) {
+    // Step 1: Find what dimension this elements wants to be. Only the subtrees
+    // which asked for another iteration are recomputed.
+    node->ComputeRequirementIfNeeded();
 
     // Step 2: Assign a dimension to the element.
-    node->SetBox(box);
+    node->SetBoxIfNeeded(box);
 
     // Check if the element needs another iteration of the layout algorithm.
-    status.need_iteration = false;
-    status.iteration++;
-    node->Check(&status);
+    status->need_iteration = false;
+    status->iteration++;
+    node->CheckLayout(status);
   }
 
   // Step 3: Draw the element.
@@ -78,6 +123,22 @@ void Render(Screen& screen, Node* node) {
   screen.ApplyShader();
 }
 
+/// @brief Lay out and draw large sets of siblings concurrently, using a pool of
+/// |threads| worker threads. This is disabled by default, or with |threads| = 0.
+///
+/// When enabled, the ComputeRequirement(), SetBox() and Render() of custom
+/// Node, and the user functions called by the elements (e.g. canvas, graph)
+/// must be thread-safe. Elements modifying the Screen outside of their box,
+/// like frame and focus, are drawn sequentially with their siblings.
+///
+/// The pool is also used by Screen::ToString() to encode large screens.
+///
+/// This must not be called while rendering.
+/// @ingroup dom
+void SetParallelLayout(int threads) {
+  parallel::SetThreads(threads);
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -24,7 +24,7 @@ class Reflect : public Node {
   void SetBox(Box box) final {
     reflected_box_ = box;
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfNeeded(box);
   }
 
   void Render(Screen& screen) final {
@@ -31,7 +31,7 @@ Element vscroll_indicator(Element child) {
       if (box_.x_min > box_.x_max) {
         box_.x_max--;
       }
-      children_[0]->SetBox(box);
+      children_[0]->SetBoxIfNeeded(box);
     }
 
     void Render(Screen& screen) final {
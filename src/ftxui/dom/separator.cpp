@@ -30,11 +30,10 @@ const Charsets charsets = {
 
 class Separator : public Node {
  public:
-  explicit Separator(std::string value) : value_(std::move(value)) {}
-
-  void ComputeRequirement() override {
+  explicit Separator(std::string value) : value_(std::move(value)) {
     requirement_.min_x = 1;
     requirement_.min_y = 1;
+    requirement_final_ = true;
   }
 
   void Render(Screen& screen) override {
@@ -42,9 +41,9 @@ class Separator : public Node {
       for (int x = box_.x_min; x <= box_.x_max; ++x) {
         Pixel& pixel = screen.PixelAt(x, y);
         pixel.character = value_;
-        pixel.automerge = true;
       }
     }
+    screen.MarkAutomerge(box_);
   }
 
   std::string value_;
@@ -52,11 +51,10 @@ class Separator : public Node {
 
 class SeparatorAuto : public Node {
  public:
-  explicit SeparatorAuto(BorderStyle style) : style_(style) {}
-
-  void ComputeRequirement() override {
+  explicit SeparatorAuto(BorderStyle style) : style_(style) {
     requirement_.min_x = 1;
     requirement_.min_y = 1;
+    requirement_final_ = true;
   }
 
   void Render(Screen& screen) override {
@@ -69,9 +67,9 @@ class SeparatorAuto : public Node {
       for (int x = box_.x_min; x <= box_.x_max; ++x) {
         Pixel& pixel = screen.PixelAt(x, y);
         pixel.character = c;
-        pixel.automerge = true;
       }
     }
+    screen.MarkAutomerge(box_);
   }
 
   BorderStyle style_;
@@ -89,6 +87,7 @@ class SeparatorWithPixel : public SeparatorAuto {
         screen.PixelAt(x, y) = pixel_;
       }
     }
+    screen.MarkAutomerge(box_);
   }
 
  private:
@@ -401,10 +400,10 @@ Element separatorHSelector(float left,
         : left_(left),
           right_(right),
           unselected_color_(unselected_color),
-          selected_color_(selected_color) {}
-    void ComputeRequirement() override {
+          selected_color_(selected_color) {
       requirement_.min_x = 1;
       requirement_.min_y = 1;
+      requirement_final_ = true;
     }
 
     void Render(Screen& screen) override {
@@ -417,6 +416,7 @@ Element separatorHSelector(float left,
       int demi_cell_right = int(right_ * 2.F + 2.F);  // NOLINT
 
       int y = box_.y_min;
+      screen.MarkAutomerge({box_.x_min, box_.x_max, y, y});
       for (int x = box_.x_min; x <= box_.x_max; ++x) {
         Pixel& pixel = screen.PixelAt(x, y);
 
@@ -427,7 +427,6 @@ Element separatorHSelector(float left,
 
         if (!a_empty && !b_empty) {
           pixel.character = "─";
-          pixel.automerge = true;
         } else {
           pixel.character = a_empty ? "╶" : "╴";  // NOLINT
           pixel.automerge = false;
@@ -471,10 +470,10 @@ Element separatorVSelector(float up,
         : up_(up),
           down_(down),
           unselected_color_(unselected_color),
-          selected_color_(selected_color) {}
-    void ComputeRequirement() override {
+          selected_color_(selected_color) {
       requirement_.min_x = 1;
       requirement_.min_y = 1;
+      requirement_final_ = true;
     }
 
     void Render(Screen& screen) override {
@@ -487,6 +486,7 @@ Element separatorVSelector(float up,
       int demi_cell_down = int(down_ * 2 + 2);
 
       int x = box_.x_min;
+      screen.MarkAutomerge({x, x, box_.y_min, box_.y_max});
       for (int y = box_.y_min; y <= box_.y_max; ++y) {
         Pixel& pixel = screen.PixelAt(x, y);
 
@@ -497,7 +497,6 @@ Element separatorVSelector(float up,
 
         if (!a_empty && !b_empty) {
           pixel.character = "│";
-          pixel.automerge = true;
         } else {
           pixel.character = a_empty ? "╷" : "╵";  // NOLINT
           pixel.automerge = false;
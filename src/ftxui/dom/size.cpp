@@ -67,7 +67,7 @@ class Size : public Node {
           break;
       }
     }
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfNeeded(box);
   }
 
  private:
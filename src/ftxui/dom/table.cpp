@@ -1,10 +1,17 @@
 #include "ftxui/dom/table.hpp"
 
-#include <algorithm>  // for max
+#include <algorithm>  // for max, min
+#include <cstddef>    // for size_t
 #include <memory>   // for allocator, shared_ptr, allocator_traits<>::value_type
 #include <utility>  // for move, swap
 
-#include "ftxui/dom/elements.hpp"  // for Element, operator|, text, separatorCharacter, Elements, BorderStyle, Decorator, emptyElement, size, gridbox, EQUAL, flex, flex_shrink, HEIGHT, WIDTH
+#include "ftxui/dom/box_helper.hpp"  // for Element, Compute
+#include "ftxui/dom/elements.hpp"  // for Element, operator|, text, separatorCharacter, Elements, BorderStyle, Decorator, emptyElement, automerge
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/parallel.hpp"  // for For
+#include "ftxui/screen/screen.hpp"    // for Screen, Pixel
 
 namespace ftxui {
 namespace {
@@ -13,6 +20,10 @@ bool IsCell(int x, int y) {
   return x % 2 == 1 && y % 2 == 1;
 }
 
+bool IsCorner(int x, int y) {
+  return x % 2 == 0 && y % 2 == 0;
+}
+
 // NOLINTNEXTLINE
 static std::string charset[5][6] = {
     {"┌", "┐", "└", "┘", "─", "│"},  //
@@ -22,6 +33,17 @@ static std::string charset[5][6] = {
     {" ", " ", " ", " ", " ", " "},  //
 };
 
+// A glyph is 1 + 6 * border + index, with |index| the position in |charset|.
+// The first 4 characters are corners, drawn like `text(c) | automerge`. The
+// last 2 are lines, drawn like `separatorCharacter(c)`.
+const std::string& GlyphCharacter(uint8_t glyph) {
+  return charset[(glyph - 1) / 6][(glyph - 1) % 6];  // NOLINT
+}
+
+bool IsCornerGlyph(uint8_t glyph) {
+  return (glyph - 1) % 6 < 4;  // NOLINT
+}
+
 int Wrap(int input, int modulo) {
   input %= modulo;
   input += modulo;
@@ -35,6 +57,204 @@ void Order(int& a, int& b) {
   }
 }
 
+Elements Children(const Elements& cells, const Elements& decorated) {
+  Elements children = cells;
+  for (const auto& element : decorated) {
+    if (element) {
+      children.push_back(element);
+    }
+  }
+  return children;
+}
+
+// Lay out and draw the table directly, instead of expanding it into a gridbox
+// of flex/size decorated elements. Undecorated lines and corners have no node.
+class TableNode : public Node {
+ public:
+  TableNode(int dim_x,
+            int dim_y,
+            Elements cells,
+            std::vector<uint8_t> glyphs,
+            Elements decorated)
+      : Node(Children(cells, decorated)),
+        dim_x_(dim_x),
+        dim_y_(dim_y),
+        cells_(std::move(cells)),
+        glyphs_(std::move(glyphs)),
+        decorated_(std::move(decorated)) {}
+
+  void ComputeRequirement() override {
+    Node::ComputeRequirement();
+    requirement_ = Requirement();
+
+    // Compute the size of each column and row, in a single pass.
+    box_helper::Element init;
+    init.min_size = 0;
+    init.flex_grow = 1024;    // NOLINT
+    init.flex_shrink = 1024;  // NOLINT
+    columns_.assign(dim_x_, init);
+    rows_.assign(dim_y_, init);
+    int selected_x = 0;
+    int selected_y = 0;
+    for (int x = 0; x < dim_x_; ++x) {
+      auto& column = columns_[x];
+      for (int y = 0; y < dim_y_; ++y) {
+        const Requirement r = SlotRequirement(x, y);
+        auto& row = rows_[y];
+        column.min_size = std::max(column.min_size, r.min_x);
+        row.min_size = std::max(row.min_size, r.min_y);
+        column.flex_grow = std::min(column.flex_grow, r.flex_grow_x);
+        row.flex_grow = std::min(row.flex_grow, r.flex_grow_y);
+        column.flex_shrink = std::min(column.flex_shrink, r.flex_shrink_x);
+        row.flex_shrink = std::min(row.flex_shrink, r.flex_shrink_y);
+
+        // Forward the selected/focused child state:
+        if (requirement_.selection < r.selection) {
+          requirement_.selection = r.selection;
+          requirement_.selected_box = r.selected_box;
+          selected_x = x;
+          selected_y = y;
+        }
+      }
+    }
+
+    int offset_x = 0;
+    int offset_y = 0;
+    for (int x = 0; x < dim_x_; ++x) {
+      if (x < selected_x) {
+        offset_x += columns_[x].min_size;
+      }
+      requirement_.min_x += columns_[x].min_size;
+    }
+    for (int y = 0; y < dim_y_; ++y) {
+      if (y < selected_y) {
+        offset_y += rows_[y].min_size;
+      }
+      requirement_.min_y += rows_[y].min_size;
+    }
+    requirement_.selected_box.x_min += offset_x;
+    requirement_.selected_box.x_max += offset_x;
+    requirement_.selected_box.y_min += offset_y;
+    requirement_.selected_box.y_max += offset_y;
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+
+    auto columns = columns_;
+    auto rows = rows_;
+    box_helper::Compute(&columns, box.x_max - box.x_min + 1);
+    box_helper::Compute(&rows, box.y_max - box.y_min + 1);
+
+    // Position of each column and row:
+    x_min_.assign(dim_x_ + 1, box.x_min);
+    y_min_.assign(dim_y_ + 1, box.y_min);
+    for (int x = 0; x < dim_x_; ++x) {
+      x_min_[x + 1] = x_min_[x] + columns[x].size;
+    }
+    for (int y = 0; y < dim_y_; ++y) {
+      y_min_[y + 1] = y_min_[y] + rows[y].size;
+    }
+
+    parallel::For(dim_x_, [&](size_t x) {
+      for (int y = 0; y < dim_y_; ++y) {
+        if (Node* node = SlotElement(int(x), y)) {
+          node->SetBoxIfNeeded(SlotBox(int(x), y));
+        }
+      }
+    });
+  }
+
+  void Render(Screen& screen) override {
+    Node::Render(screen);
+
+    for (int x = 0; x < dim_x_; ++x) {
+      for (int y = 0; y < dim_y_; ++y) {
+        const uint8_t glyph = glyphs_[x * dim_y_ + y];
+        if (glyph == 0 || SlotElement(x, y)) {
+          continue;
+        }
+        const Box box = SlotBox(x, y);
+        const std::string& character = GlyphCharacter(glyph);
+        screen.MarkAutomerge(box);
+        for (int py = box.y_min; py <= box.y_max; ++py) {
+          for (int px = box.x_min; px <= box.x_max; ++px) {
+            Pixel& pixel = screen.PixelAt(px, py);
+            if (!IsCornerGlyph(glyph) || (px == box.x_min && py == box.y_min)) {
+              pixel.character = character;
+            }
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  // The element drawn in the slot (x,y), or nullptr when the slot is drawn
+  // directly.
+  Node* SlotElement(int x, int y) const {
+    if (IsCell(x, y)) {
+      return cells_[(x / 2) * (dim_y_ / 2) + y / 2].get();
+    }
+    return decorated_[x * dim_y_ + y].get();
+  }
+
+  // The requirement of the slot, as if it was decorated by `flex` for lines,
+  // `flex_shrink` for cells and `size(WIDTH/HEIGHT, EQUAL, 0)` for corners.
+  Requirement SlotRequirement(int x, int y) const {
+    Requirement r;
+    if (Node* node = SlotElement(x, y)) {
+      r = node->requirement();
+    } else if (glyphs_[x * dim_y_ + y] != 0) {
+      r.min_x = 1;
+      r.min_y = 1;
+    }
+
+    if (IsCell(x, y)) {
+      r.flex_shrink_x = 1;
+      r.flex_shrink_y = 1;
+    } else if (IsCorner(x, y)) {
+      r.min_x = 0;
+      r.min_y = 0;
+      r.flex_grow_x = 0;
+      r.flex_grow_y = 0;
+      r.flex_shrink_x = 0;
+      r.flex_shrink_y = 0;
+    } else {
+      r.flex_grow_x = 1;
+      r.flex_grow_y = 1;
+      r.flex_shrink_x = 1;
+      r.flex_shrink_y = 1;
+    }
+    return r;
+  }
+
+  Box SlotBox(int x, int y) const {
+    Box box;
+    box.x_min = x_min_[x];
+    box.x_max = x_min_[x + 1] - 1;
+    box.y_min = y_min_[y];
+    box.y_max = y_min_[y + 1] - 1;
+    // Corners are at most 2x2, like with size(WIDTH/HEIGHT, EQUAL, 0).
+    if (IsCorner(x, y)) {
+      box.x_max = std::min(box.x_min + 1, box.x_max);
+      box.y_max = std::min(box.y_min + 1, box.y_max);
+    }
+    return box;
+  }
+
+  int dim_x_;
+  int dim_y_;
+  Elements cells_;
+  std::vector<uint8_t> glyphs_;
+  Elements decorated_;
+
+  std::vector<box_helper::Element> columns_;
+  std::vector<box_helper::Element> rows_;
+  std::vector<int> x_min_;
+  std::vector<int> y_min_;
+};
+
 }  // namespace
 
 Table::Table() {
@@ -67,40 +287,49 @@ void Table::Initialize(std::vector<std::vector<Element>> input) {
   dim_y_ = 2 * input_dim_y_ + 1;
   dim_x_ = 2 * input_dim_x_ + 1;
 
-  // Reserve space.
-  elements_.resize(dim_y_);
-  for (int y = 0; y < dim_y_; ++y) {
-    elements_[y].resize(dim_x_);
-  }
-
-  // Transfert elements_ from |input| toward |elements_|.
-  {
-    int y = 1;
-    for (auto& row : input) {
-      int x = 1;
-      for (auto& cell : row) {
-        elements_[y][x] = std::move(cell);
-        x += 2;
+  // Transfert the cells from |input|, column by column.
+  cells_.resize(size_t(input_dim_x_) * size_t(input_dim_y_));
+  for (int y = 0; y < input_dim_y_; ++y) {
+    auto& row = input[y];
+    for (int x = 0; x < input_dim_x_; ++x) {
+      Element& cell = cells_[x * input_dim_y_ + y];
+      if (x < (int)row.size() && row[x]) {
+        cell = std::move(row[x]);
+      } else {
+        cell = emptyElement();
       }
-      y += 2;
     }
   }
 
-  // Add empty element for the border.
-  for (int y = 0; y < dim_y_; ++y) {
-    for (int x = 0; x < dim_x_; ++x) {
-      auto& element = elements_[y][x];
+  glyphs_.assign(size_t(dim_x_) * size_t(dim_y_), 0);
+  decorated_.assign(size_t(dim_x_) * size_t(dim_y_), nullptr);
+}
 
-      if (IsCell(x, y)) {
-        if (!element) {
-          element = emptyElement();
-        }
-        continue;
-      }
+// NOLINTNEXTLINE
+void Table::DecorateSlot(int x, int y, const Decorator& decorator) {
+  if (IsCell(x, y)) {
+    Element& cell = cells_[(x / 2) * input_dim_y_ + y / 2];
+    cell = std::move(cell) | decorator;
+    return;
+  }
 
-      element = emptyElement();
-    }
+  // Lines and corners become elements once decorated.
+  const size_t index = x * dim_y_ + y;
+  Element& element = decorated_[index];
+  if (!element) {
+    const uint8_t glyph = glyphs_[index];
+    element = glyph == 0              ? emptyElement()
+              : IsCornerGlyph(glyph) ? text(GlyphCharacter(glyph)) | automerge
+                                     : separatorCharacter(GlyphCharacter(glyph));
   }
+  element = std::move(element) | decorator;
+}
+
+// Replace the line or corner (x,y) by the |index|-th character of |border|.
+void Table::SetGlyph(int x, int y, BorderStyle border, int index) {
+  const size_t slot = x * dim_y_ + y;
+  glyphs_[slot] = uint8_t(1 + 6 * int(border) + index);  // NOLINT
+  decorated_[slot] = nullptr;
 }
 
 TableSelection Table::SelectRow(int index) {
@@ -154,37 +383,19 @@ TableSelection Table::SelectAll() {
 }
 
 Element Table::Render() {
-  for (int y = 0; y < dim_y_; ++y) {
-    for (int x = 0; x < dim_x_; ++x) {
-      auto& it = elements_[y][x];
-
-      // Line
-      if ((x + y) % 2 == 1) {
-        it = std::move(it) | flex;
-        continue;
-      }
-
-      // Cells
-      if ((x % 2) == 1 && (y % 2) == 1) {
-        it = std::move(it) | flex_shrink;
-        continue;
-      }
-
-      // Corners
-      it = std::move(it) | size(WIDTH, EQUAL, 0) | size(HEIGHT, EQUAL, 0);
-    }
-  }
+  auto table = std::make_shared<TableNode>(dim_x_, dim_y_, std::move(cells_),
+                                           std::move(glyphs_),
+                                           std::move(decorated_));
   dim_x_ = 0;
   dim_y_ = 0;
-  return gridbox(std::move(elements_));
+  return table;
 }
 
 // NOLINTNEXTLINE
 void TableSelection::Decorate(Decorator decorator) {
   for (int y = y_min_; y <= y_max_; ++y) {
     for (int x = x_min_; x <= x_max_; ++x) {
-      Element& e = table_->elements_[y][x];
-      e = std::move(e) | decorator;
+      table_->DecorateSlot(x, y, decorator);
     }
   }
 }
@@ -194,8 +405,7 @@ void TableSelection::DecorateCells(Decorator decorator) {
   for (int y = y_min_; y <= y_max_; ++y) {
     for (int x = x_min_; x <= x_max_; ++x) {
       if (y % 2 == 1 && x % 2 == 1) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
+        table_->DecorateSlot(x, y, decorator);
       }
     }
   }
@@ -208,8 +418,7 @@ void TableSelection::DecorateAlternateColumn(Decorator decorator,
   for (int y = y_min_; y <= y_max_; ++y) {
     for (int x = x_min_; x <= x_max_; ++x) {
       if (y % 2 == 1 && (x / 2) % modulo == shift) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
+        table_->DecorateSlot(x, y, decorator);
       }
     }
   }
@@ -222,8 +431,7 @@ void TableSelection::DecorateAlternateRow(Decorator decorator,
   for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
     for (int x = x_min_; x <= x_max_; ++x) {
       if (y % 2 == 1 && (y / 2) % modulo == shift) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
+        table_->DecorateSlot(x, y, decorator);
       }
     }
   }
@@ -236,8 +444,7 @@ void TableSelection::DecorateCellsAlternateColumn(Decorator decorator,
   for (int y = y_min_; y <= y_max_; ++y) {
     for (int x = x_min_; x <= x_max_; ++x) {
       if (y % 2 == 1 && x % 2 == 1 && ((x / 2) % modulo == shift)) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
+        table_->DecorateSlot(x, y, decorator);
       }
     }
   }
@@ -250,8 +457,7 @@ void TableSelection::DecorateCellsAlternateRow(Decorator decorator,
   for (int y = y_min_; y <= y_max_; ++y) {
     for (int x = x_min_; x <= x_max_; ++x) {
       if (y % 2 == 1 && x % 2 == 1 && ((y / 2) % modulo == shift)) {
-        Element& e = table_->elements_[y][x];
-        e = std::move(e) | decorator;
+        table_->DecorateSlot(x, y, decorator);
       }
     }
   }
@@ -263,24 +469,17 @@ void TableSelection::Border(BorderStyle border) {
   BorderTop(border);
   BorderBottom(border);
 
-  // NOLINTNEXTLINE
-  table_->elements_[y_min_][x_min_] = text(charset[border][0]) | automerge;
-  // NOLINTNEXTLINE
-  table_->elements_[y_min_][x_max_] = text(charset[border][1]) | automerge;
-  // NOLINTNEXTLINE
-  table_->elements_[y_max_][x_min_] = text(charset[border][2]) | automerge;
-  // NOLINTNEXTLINE
-  table_->elements_[y_max_][x_max_] = text(charset[border][3]) | automerge;
+  table_->SetGlyph(x_min_, y_min_, border, 0);
+  table_->SetGlyph(x_max_, y_min_, border, 1);
+  table_->SetGlyph(x_min_, y_max_, border, 2);
+  table_->SetGlyph(x_max_, y_max_, border, 3);
 }
 
 void TableSelection::Separator(BorderStyle border) {
   for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
     for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
       if (y % 2 == 0 || x % 2 == 0) {
-        Element& e = table_->elements_[y][x];
-        e = (y % 2 == 1)
-                ? separatorCharacter(charset[border][5]) | automerge   // NOLINT
-                : separatorCharacter(charset[border][4]) | automerge;  // NOLINT
+        table_->SetGlyph(x, y, border, (y % 2 == 1) ? 5 : 4);  // NOLINT
       }
     }
   }
@@ -290,8 +489,7 @@ void TableSelection::SeparatorVertical(BorderStyle border) {
   for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
     for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
       if (x % 2 == 0) {
-        table_->elements_[y][x] =
-            separatorCharacter(charset[border][5]) | automerge;  // NOLINT
+        table_->SetGlyph(x, y, border, 5);  // NOLINT
       }
     }
   }
@@ -301,8 +499,7 @@ void TableSelection::SeparatorHorizontal(BorderStyle border) {
   for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
     for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
       if (y % 2 == 0) {
-        table_->elements_[y][x] =
-            separatorCharacter(charset[border][4]) | automerge;  // NOLINT
+        table_->SetGlyph(x, y, border, 4);  // NOLINT
       }
     }
   }
@@ -310,29 +507,25 @@ void TableSelection::SeparatorHorizontal(BorderStyle border) {
 
 void TableSelection::BorderLeft(BorderStyle border) {
   for (int y = y_min_; y <= y_max_; y++) {
-    table_->elements_[y][x_min_] =
-        separatorCharacter(charset[border][5]) | automerge;  // NOLINT
+    table_->SetGlyph(x_min_, y, border, 5);  // NOLINT
   }
 }
 
 void TableSelection::BorderRight(BorderStyle border) {
   for (int y = y_min_; y <= y_max_; y++) {
-    table_->elements_[y][x_max_] =
-        separatorCharacter(charset[border][5]) | automerge;  // NOLINT
+    table_->SetGlyph(x_max_, y, border, 5);  // NOLINT
   }
 }
 
 void TableSelection::BorderTop(BorderStyle border) {
   for (int x = x_min_; x <= x_max_; x++) {
-    table_->elements_[y_min_][x] =
-        separatorCharacter(charset[border][4]) | automerge;  // NOLINT
+    table_->SetGlyph(x, y_min_, border, 4);  // NOLINT
   }
 }
 
 void TableSelection::BorderBottom(BorderStyle border) {
   for (int x = x_min_; x <= x_max_; x++) {
-    table_->elements_[y_max_][x] =
-        separatorCharacter(charset[border][4]) | automerge;  // NOLINT
+    table_->SetGlyph(x, y_max_, border, 4);  // NOLINT
   }
 }
 
@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 #include <memory>  // for allocator
+#include <string>  // for string, to_string
+#include <vector>  // for vector
 
-#include "ftxui/dom/elements.hpp"  // for LIGHT, flex, center, EMPTY, DOUBLE
+#include "ftxui/dom/elements.hpp"  // for LIGHT, flex, center, EMPTY, DOUBLE, color
 #include "ftxui/dom/node.hpp"      // for Render
 #include "ftxui/dom/table.hpp"
+#include "ftxui/screen/color.hpp"   // for Color
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 namespace ftxui {
@@ -708,6 +711,42 @@ TEST(TableTest, RowFlexTwo) {
       screen.ToString());
 }
 
+TEST(TableTest, DecorateBorder) {
+  auto table = Table(std::vector<std::vector<std::string>>{
+      {"a", "b"},
+      {"c", "d"},
+  });
+  table.SelectAll().Border(LIGHT);
+  table.SelectRow(0).Decorate(color(Color::Red));
+  // Replacing a line drops its decorations, like replacing an element.
+  table.SelectRow(1).BorderBottom(DOUBLE);
+  Screen screen(4, 4);
+  Render(screen, table.Render());
+  EXPECT_EQ(screen.PixelAt(0, 0).character, "┌");
+  EXPECT_EQ(screen.PixelAt(1, 3).character, "═");
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color::Red);
+  EXPECT_EQ(screen.PixelAt(1, 1).foreground_color, Color::Red);
+  EXPECT_EQ(screen.PixelAt(0, 2).foreground_color, Color::Default);
+  EXPECT_EQ(screen.PixelAt(1, 3).foreground_color, Color::Default);
+}
+
+TEST(TableTest, ManyRows) {
+  std::vector<std::vector<std::string>> rows;
+  for (int i = 0; i < 10000; ++i) {
+    rows.push_back({std::to_string(i), std::to_string(2 * i)});
+  }
+  auto table = Table(std::move(rows));
+  table.SelectAll().Border(LIGHT);
+  table.SelectAll().SeparatorVertical(LIGHT);
+  Screen screen(14, 3);
+  Render(screen, table.Render());
+  EXPECT_EQ(
+      "┌────┬─────┐  \r\n"
+      "│0   │0    │  \r\n"
+      "└────┴─────┘  ",
+      screen.ToString());
+}
+
 }  // namespace ftxui
 
 // Copyright 2021 Arthur Sonzogni. All rights reserved.
@@ -18,11 +18,10 @@ using ftxui::Screen;
 
 class Text : public Node {
  public:
-  explicit Text(std::string text) : text_(std::move(text)) {}
-
-  void ComputeRequirement() override {
+  explicit Text(std::string text) : text_(std::move(text)) {
     requirement_.min_x = string_width(text_);
     requirement_.min_y = 1;
+    requirement_final_ = true;
   }
 
   void Render(Screen& screen) override {
@@ -47,11 +46,10 @@ class Text : public Node {
 class VText : public Node {
  public:
   explicit VText(std::string text)
-      : text_(std::move(text)), width_{std::min(string_width(text_), 1)} {}
-
-  void ComputeRequirement() override {
+      : text_(std::move(text)), width_{std::min(string_width(text_), 1)} {
     requirement_.min_x = width_;
     requirement_.min_y = string_width(text_);
+    requirement_final_ = true;
   }
 
   void Render(Screen& screen) override {
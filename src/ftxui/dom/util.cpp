@@ -96,19 +96,19 @@ Dimensions Dimension::Fit(Element& e) {
   box.y_max = fullsize.dimy;
 
   Node::Status status;
-  e->Check(&status);
+  e->CheckLayout(&status);
   const int max_iteration = 20;
   while (status.need_iteration && status.iteration < max_iteration) {
-    e->ComputeRequirement();
+    e->ComputeRequirementIfNeeded();
 
     // Don't give the element more space than it needs:
     box.x_max = std::min(box.x_max, e->requirement().min_x);
     box.y_max = std::min(box.y_max, e->requirement().min_y);
 
-    e->SetBox(box);
+    e->SetBoxIfNeeded(box);
     status.need_iteration = false;
     status.iteration++;
-    e->Check(&status);
+    e->CheckLayout(&status);
 
     if (!status.need_iteration) {
       break;
@@ -129,10 +129,8 @@ Dimensions Dimension::Fit(Element& e) {
 /// @ingroup dom
 Element emptyElement() {
   class Impl : public Node {
-    void ComputeRequirement() override {
-      requirement_.min_x = 0;
-      requirement_.min_x = 0;
-    }
+   public:
+    Impl() { requirement_final_ = true; }
   };
   return std::make_unique<Impl>();
 }
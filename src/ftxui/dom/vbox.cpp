@@ -9,6 +9,7 @@
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/parallel.hpp"  // for For
 
 namespace ftxui {
 
@@ -24,8 +25,13 @@ class VBox : public Node {
     requirement_.flex_shrink_x = 0;
     requirement_.flex_shrink_y = 0;
     requirement_.selection = Requirement::NORMAL;
+    // The requirement is a function of the children's one only.
+    requirement_final_ = true;
+    parallel::For(children_.size(), [&](size_t i) {
+      children_[i]->ComputeRequirementIfNeeded();
+    });
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      requirement_final_ &= child->requirement_final();
       if (requirement_.selection < child->requirement().selection) {
         requirement_.selection = child->requirement().selection;
         requirement_.selected_box = child->requirement().selected_box;
@@ -52,13 +58,15 @@ class VBox : public Node {
     int target_size = box.y_max - box.y_min + 1;
     box_helper::Compute(&elements, target_size);
 
+    std::vector<Box> boxes(children_.size(), box);
     int y = box.y_min;
     for (size_t i = 0; i < children_.size(); ++i) {
-      box.y_min = y;
-      box.y_max = y + elements[i].size - 1;
-      children_[i]->SetBox(box);
-      y = box.y_max + 1;
+      boxes[i].y_min = y;
+      boxes[i].y_max = y + elements[i].size - 1;
+      y = boxes[i].y_max + 1;
     }
+    parallel::For(children_.size(),
+                  [&](size_t i) { children_[i]->SetBoxIfNeeded(boxes[i]); });
   }
 };
 
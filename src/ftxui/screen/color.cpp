@@ -1,7 +1,10 @@
 #include "ftxui/screen/color.hpp"
 
+#include <algorithm>    // for copy, equal, max, min
 #include <array>        // for array
+#include <cstdlib>      // for abs
 #include <string_view>  // for literals
+#include <vector>       // for vector
 
 #include "ftxui/screen/color_info.hpp"  // for GetColorInfo, ColorInfo
 #include "ftxui/screen/terminal.hpp"  // for ColorSupport, Color, Palette256, TrueColor
@@ -30,6 +33,97 @@ const std::array<const char*, 33> palette16code = {
     "97", "107",  //
 };
 
+// The 256 colors palette is made of the 16 base colors, a 6x6x6 cube of colors
+// [16,231] and 24 grays [232,255]. Since the cube is a product of the same 6
+// levels on each channel, its closest color is found one channel at a time.
+// The closest gray is the one closest to the mean of the channels. This
+// replaces a comparison with each of the 240 colors.
+struct Quantizer {
+  static constexpr int cube_begin = 16;
+  static constexpr int gray_begin = 232;
+  static constexpr int gray_count = 24;
+
+  std::array<uint8_t, 6> cube_levels = {};
+  std::array<uint8_t, gray_count> gray_levels = {};
+  // The index of the closest level of the cube, for each channel value.
+  std::array<uint8_t, 256> closest_level = {};
+
+  Quantizer() {
+    for (int i = 0; i < 6; ++i) {  // NOLINT
+      cube_levels[i] = GetColorInfo(Color::Palette256(cube_begin + i)).blue;
+    }
+    for (int i = 0; i < gray_count; ++i) {
+      gray_levels[i] = GetColorInfo(Color::Palette256(gray_begin + i)).red;
+    }
+    for (int value = 0; value < 256; ++value) {  // NOLINT
+      int best = 0;
+      for (int i = 1; i < 6; ++i) {  // NOLINT
+        if (std::abs(cube_levels[i] - value) <
+            std::abs(cube_levels[best] - value)) {
+          best = i;
+        }
+      }
+      closest_level[value] = best;
+    }
+  }
+
+  // Return the index of the closest color in [16,255]. On equality, the lowest
+  // index wins.
+  uint8_t Closest(uint8_t red, uint8_t green, uint8_t blue) const {
+    auto distance = [&](int r, int g, int b) {
+      return (r - red) * (r - red) + (g - green) * (g - green) +
+             (b - blue) * (b - blue);
+    };
+
+    const int r = closest_level[red];
+    const int g = closest_level[green];
+    const int b = closest_level[blue];
+    int best = cube_begin + 36 * r + 6 * g + b;  // NOLINT
+    int best_distance =
+        distance(cube_levels[r], cube_levels[g], cube_levels[b]);
+
+    // Grays are evenly spaced. Check the ones around the mean.
+    const int mean = (red + green + blue) / 3;
+    const int step = gray_levels[1] - gray_levels[0];
+    const int center = (mean - gray_levels[0]) / step;
+    for (int i = std::max(0, center - 1);
+         i <= std::min(gray_count - 1, center + 1); ++i) {
+      const int level = gray_levels[i];
+      const int d = distance(level, level, level);
+      if (d < best_distance) {
+        best_distance = d;
+        best = gray_begin + i;
+      }
+    }
+    return best;
+  }
+};
+
+// The SGR parameters, computed once.
+struct SGRTable {
+  std::array<std::string, 256> decimal;
+  std::array<std::string, 256> foreground_256;
+  std::array<std::string, 256> background_256;
+
+  SGRTable() {
+    for (int i = 0; i < 256; ++i) {  // NOLINT
+      decimal[i] = std::to_string(i);
+      foreground_256[i] = "38;5;" + decimal[i];
+      background_256[i] = "48;5;" + decimal[i];
+    }
+  }
+};
+
+const SGRTable& GetSGRTable() {
+  static const SGRTable table;
+  return table;
+}
+
+const Quantizer& GetQuantizer() {
+  static const Quantizer quantizer;
+  return quantizer;
+}
+
 }  // namespace
 
 bool Color::operator==(const Color& rhs) const {
@@ -42,22 +136,39 @@ bool Color::operator!=(const Color& rhs) const {
 }
 
 std::string Color::Print(bool is_background_color) const {
+  std::string out;
+  PrintTo(out, is_background_color);
+  return out;
+}
+
+/// @brief Append the SGR parameters selecting this color to |out|. This is the
+/// same as `Print`, without allocating. The parameters of the palette colors
+/// are precomputed.
+void Color::PrintTo(std::string& out, bool is_background_color) const {
+  const SGRTable& table = GetSGRTable();
   switch (type_) {
     case ColorType::Palette1:
-      return is_background_color ? "49"s : "39"s;
+      out += is_background_color ? "49"sv : "39"sv;
+      return;
 
     case ColorType::Palette16:
-      return palette16code[2 * red_ + is_background_color];  // NOLINT;
+      out += palette16code[2 * red_ + is_background_color];  // NOLINT;
+      return;
 
     case ColorType::Palette256:
-      return (is_background_color ? "48;5;"s : "38;5;"s) + std::to_string(red_);
+      out += is_background_color ? table.background_256[red_]
+                                 : table.foreground_256[red_];
+      return;
 
     case ColorType::TrueColor:
     default:
-      return (is_background_color ? "48;2;"s : "38;2;"s)  //
-             + std::to_string(red_) + ";"                 //
-             + std::to_string(green_) + ";"               //
-             + std::to_string(blue_);                     //
+      out += is_background_color ? "48;2;"sv : "38;2;"sv;
+      out += table.decimal[red_];
+      out += ';';
+      out += table.decimal[green_];
+      out += ';';
+      out += table.decimal[blue_];
+      return;
   }
 }
 
@@ -97,22 +208,7 @@ Color::Color(uint8_t red, uint8_t green, uint8_t blue)
   }
 
   // Find the closest Color from the database:
-  const int max_distance = 256 * 256 * 3;
-  int closest = max_distance;
-  int best = 0;
-  const int database_begin = 16;
-  const int database_end = 256;
-  for (int i = database_begin; i < database_end; ++i) {
-    ColorInfo color_info = GetColorInfo(Color::Palette256(i));
-    int dr = color_info.red - red;
-    int dg = color_info.green - green;
-    int db = color_info.blue - blue;
-    int dist = dr * dr + dg * dg + db * db;
-    if (closest > dist) {
-      closest = dist;
-      best = i;
-    }
-  }
+  const uint8_t best = GetQuantizer().Closest(red, green, blue);
 
   if (Terminal::ColorSupport() == Terminal::Color::Palette256) {
     type_ = ColorType::Palette256;
@@ -179,47 +275,14 @@ Color Color::Interpolate(float t, const Color& a, const Color& b) {
     }
   }
 
-  auto get_color = [](const Color& color,  //
-                      uint8_t* red, uint8_t* green, uint8_t* blue) {
-    switch (color.type_) {
-      case ColorType::Palette1: {
-        return;
-      }
-
-      case ColorType::Palette16: {
-        ColorInfo info = GetColorInfo(Color::Palette16(color.red_));
-        *red = info.red;
-        *green = info.green;
-        *blue = info.blue;
-        return;
-      }
-
-      case ColorType::Palette256: {
-        ColorInfo info = GetColorInfo(Color::Palette256(color.red_));
-        *red = info.red;
-        *green = info.green;
-        *blue = info.blue;
-        return;
-      }
-
-      case ColorType::TrueColor:
-      default: {
-        *red = color.red_;
-        *green = color.green_;
-        *blue = color.blue_;
-        return;
-      }
-    }
-  };
-
   uint8_t red_a = 0;
   uint8_t green_a = 0;
   uint8_t blue_a = 0;
   uint8_t red_b = 0;
   uint8_t green_b = 0;
   uint8_t blue_b = 0;
-  get_color(a, &red_a, &green_a, &blue_a);
-  get_color(b, &red_b, &green_b, &blue_b);
+  a.GetRGB(&red_a, &green_a, &blue_a);
+  b.GetRGB(&red_b, &green_b, &blue_b);
 
   return Color::RGB(static_cast<uint8_t>(static_cast<float>(red_a) * (1 - t) +
                                          static_cast<float>(red_b) * t),
@@ -229,6 +292,92 @@ Color Color::Interpolate(float t, const Color& a, const Color& b) {
                                          static_cast<float>(blue_b) * t));
 }
 
+/// @brief Build |count| colors, evenly interpolated from |a| to |b|.
+/// This is faster than calling `Interpolate` once per color.
+/// @param count the number of colors.
+/// @param a the first color.
+/// @param b the last color.
+/// @ingroup screen
+// static
+std::vector<Color> Color::Gradient(int count, const Color& a, const Color& b) {
+  std::vector<Color> out;
+  if (count <= 0) {
+    return out;
+  }
+  out.reserve(count);
+  if (a.type_ == ColorType::Palette1 ||  //
+      b.type_ == ColorType::Palette1) {
+    for (int i = 0; i < count; ++i) {
+      // Same as `Interpolate`: |a| while t = i / (count - 1) is below 0.5.
+      out.push_back(count == 1 || 2 * i < count - 1 ? a : b);
+    }
+    return out;
+  }
+
+  uint8_t red_a = 0;
+  uint8_t green_a = 0;
+  uint8_t blue_a = 0;
+  uint8_t red_b = 0;
+  uint8_t green_b = 0;
+  uint8_t blue_b = 0;
+  a.GetRGB(&red_a, &green_a, &blue_a);
+  b.GetRGB(&red_b, &green_b, &blue_b);
+
+  auto mix = [](float t, uint8_t x, uint8_t y) {
+    return static_cast<uint8_t>(static_cast<float>(x) * (1 - t) +
+                                static_cast<float>(y) * t);
+  };
+
+  // Consecutive colors often quantize the same, reuse them.
+  uint8_t previous[3] = {0, 0, 0};
+  for (int i = 0; i < count; ++i) {
+    const float t = count == 1 ? 0.F : float(i) / float(count - 1);
+    const uint8_t rgb[3] = {mix(t, red_a, red_b), mix(t, green_a, green_b),
+                            mix(t, blue_a, blue_b)};
+    if (i != 0 && std::equal(rgb, rgb + 3, previous)) {
+      out.push_back(out.back());
+      continue;
+    }
+    out.emplace_back(rgb[0], rgb[1], rgb[2]);
+    std::copy(rgb, rgb + 3, previous);
+  }
+  return out;
+}
+
+/// @brief The RGB components of the color. They are left untouched for the
+/// transparent color.
+void Color::GetRGB(uint8_t* red, uint8_t* green, uint8_t* blue) const {
+  switch (type_) {
+    case ColorType::Palette1: {
+      return;
+    }
+
+    case ColorType::Palette16: {
+      ColorInfo info = GetColorInfo(Color::Palette16(red_));
+      *red = info.red;
+      *green = info.green;
+      *blue = info.blue;
+      return;
+    }
+
+    case ColorType::Palette256: {
+      ColorInfo info = GetColorInfo(Color::Palette256(red_));
+      *red = info.red;
+      *green = info.green;
+      *blue = info.blue;
+      return;
+    }
+
+    case ColorType::TrueColor:
+    default: {
+      *red = red_;
+      *green = green_;
+      *blue = blue_;
+      return;
+    }
+  }
+}
+
 inline namespace literals {
 
 Color operator""_rgb(unsigned long long int combined) {
@@ -1,5 +1,6 @@
 #include "ftxui/screen/color.hpp"
 #include <gtest/gtest.h>
+#include "ftxui/screen/color_info.hpp"
 #include "ftxui/screen/terminal.hpp"
 
 namespace ftxui {
@@ -28,6 +29,19 @@ TEST(ColorTest, PrintTrueCOlor) {
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(true), "48;2;1;2;3");
 }
 
+TEST(ColorTest, PrintTo) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  std::string out = "\x1B[";
+  Color::RGB(1, 20, 255).PrintTo(out, false);
+  out += ";";
+  Color(Color::DarkRed).PrintTo(out, true);
+  out += ";";
+  Color(Color::Red).PrintTo(out, false);
+  out += ";";
+  Color().PrintTo(out, true);
+  EXPECT_EQ(out, "\x1B[38;2;1;20;255;48;5;52;31;49");
+}
+
 TEST(ColorTest, FallbackTo256) {
   Terminal::SetColorSupport(Terminal::Color::Palette256);
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(false), "38;5;16");
@@ -38,6 +52,62 @@ TEST(ColorTest, FallbackTo16) {
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(false), "30");
 }
 
+TEST(ColorTest, FallbackTo256IsClosest) {
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+  auto closest = [](int red, int green, int blue) {
+    int best = 0;
+    int best_distance = 256 * 256 * 3;
+    for (int i = 16; i < 256; ++i) {
+      ColorInfo info = GetColorInfo(Color::Palette256(i));
+      int dr = info.red - red;
+      int dg = info.green - green;
+      int db = info.blue - blue;
+      int distance = dr * dr + dg * dg + db * db;
+      if (distance < best_distance) {
+        best_distance = distance;
+        best = i;
+      }
+    }
+    return best;
+  };
+  for (int r = 0; r < 256; r += 5) {
+    for (int g = 0; g < 256; g += 3) {
+      for (int b = 0; b < 256; b += 7) {
+        EXPECT_EQ(Color::RGB(r, g, b).Print(false),
+                  Color(Color::Palette256(closest(r, g, b))).Print(false));
+      }
+    }
+  }
+  for (int v = 0; v < 256; ++v) {
+    EXPECT_EQ(Color::RGB(v, v, v).Print(false),
+              Color(Color::Palette256(closest(v, v, v))).Print(false));
+    EXPECT_EQ(Color::RGB(v, v, 255 - v).Print(false),
+              Color(Color::Palette256(closest(v, v, 255 - v))).Print(false));
+  }
+}
+
+TEST(ColorTest, Gradient) {
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+  Color a = Color::RGB(10, 200, 30);
+  Color b = Color::Blue;
+  std::vector<Color> gradient = Color::Gradient(50, a, b);
+  ASSERT_EQ(gradient.size(), 50u);
+  for (int i = 0; i < 50; ++i) {
+    EXPECT_EQ(gradient[i], Color::Interpolate(float(i) / 49.f, a, b));
+  }
+
+  EXPECT_EQ(Color::Gradient(0, a, b).size(), 0u);
+  for (int count = 1; count <= 6; ++count) {
+    std::vector<Color> to = Color::Gradient(count, Color(), b);
+    std::vector<Color> from = Color::Gradient(count, a, Color());
+    for (int i = 0; i < count; ++i) {
+      const float t = count == 1 ? 0.f : float(i) / float(count - 1);
+      EXPECT_EQ(to[i], Color::Interpolate(t, Color(), b));
+      EXPECT_EQ(from[i], Color::Interpolate(t, a, Color()));
+    }
+  }
+}
+
 TEST(ColorTest, Litterals) {
   Terminal::SetColorSupport(Terminal::Color::TrueColor);
   using namespace ftxui::literals;
@@ -0,0 +1,168 @@
+#include "ftxui/screen/parallel.hpp"
+
+#include <algorithm>           // for max, find
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <deque>               // for deque
+#include <memory>              // for shared_ptr, make_shared, unique_ptr
+#include <mutex>               // for mutex, unique_lock, lock_guard
+#include <thread>              // for thread, yield
+#include <vector>              // for vector
+
+namespace ftxui::parallel {
+
+namespace {
+
+// Below this amount of items, the synchronization costs more than it saves.
+const size_t kMinSize = 32;
+
+// A set of calls to distribute. Every thread claims chunks of indices from the
+// same counter, so idle workers steal the remaining work from busy ones.
+struct Job {
+  Job(size_t size_, size_t chunk_, const std::function<void(size_t)>* fn_)
+      : size(size_), chunk(chunk_), fn(fn_) {}
+
+  // Run chunks until none is left. Return false when nothing was left.
+  bool Run() {
+    bool ran = false;
+    while (true) {
+      size_t begin = next.fetch_add(chunk);
+      if (begin >= size) {
+        return ran;
+      }
+      size_t end = std::min(size, begin + chunk);
+      for (size_t i = begin; i < end; ++i) {
+        (*fn)(i);
+      }
+      done.fetch_add(end - begin, std::memory_order_release);
+      ran = true;
+    }
+  }
+
+  bool Exhausted() const { return next.load() >= size; }
+  bool Completed() const {
+    return done.load(std::memory_order_acquire) >= size;
+  }
+
+  const size_t size;
+  const size_t chunk;
+  const std::function<void(size_t)>* fn;
+  std::atomic<size_t> next{0};
+  std::atomic<size_t> done{0};
+};
+
+class Pool {
+ public:
+  explicit Pool(int threads) {
+    for (int i = 0; i < threads; ++i) {
+      threads_.emplace_back([this] { Worker(); });
+    }
+  }
+
+  ~Pool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      quit_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  Pool(const Pool&) = delete;
+  Pool(Pool&&) = delete;
+  Pool& operator=(const Pool&) = delete;
+  Pool& operator=(Pool&&) = delete;
+
+  void For(size_t size, const std::function<void(size_t)>& fn) {
+    const size_t slices = 4 * (threads_.size() + 1);
+    auto job = std::make_shared<Job>(size, std::max<size_t>(1, size / slices),
+                                     &fn);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      jobs_.push_back(job);
+    }
+    wake_.notify_all();
+
+    job->Run();
+
+    // The last chunks might still be running on the workers. Help with the
+    // other jobs meanwhile. This avoids deadlocks with nested calls.
+    while (!job->Completed()) {
+      if (!RunOne()) {
+        std::this_thread::yield();
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find(jobs_.begin(), jobs_.end(), job);
+    if (it != jobs_.end()) {
+      jobs_.erase(it);
+    }
+  }
+
+ private:
+  // Take the oldest job having work left, and run it. Return whether some work
+  // was done.
+  bool RunOne() {
+    std::shared_ptr<Job> job = Take(/*wait=*/false);
+    return job && job->Run();
+  }
+
+  std::shared_ptr<Job> Take(bool wait) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      while (!jobs_.empty() && jobs_.front()->Exhausted()) {
+        jobs_.pop_front();
+      }
+      if (!jobs_.empty()) {
+        return jobs_.front();
+      }
+      if (!wait || quit_) {
+        return nullptr;
+      }
+      wake_.wait(lock);
+    }
+  }
+
+  void Worker() {
+    while (std::shared_ptr<Job> job = Take(/*wait=*/true)) {
+      job->Run();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::deque<std::shared_ptr<Job>> jobs_;
+  std::vector<std::thread> threads_;
+  bool quit_ = false;
+};
+
+std::unique_ptr<Pool>& pool() {
+  static std::unique_ptr<Pool> pool;
+  return pool;
+}
+
+}  // namespace
+
+void SetThreads(int threads) {
+  pool().reset();
+  if (threads > 0) {
+    pool() = std::make_unique<Pool>(threads);
+  }
+}
+
+bool Enabled(size_t size) {
+  return size >= kMinSize && pool();
+}
+
+void RunConcurrently(size_t size, const std::function<void(size_t)>& fn) {
+  pool()->For(size, fn);
+}
+
+}  // namespace ftxui::parallel
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
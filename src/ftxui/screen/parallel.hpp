@@ -0,0 +1,42 @@
+#ifndef FTXUI_SCREEN_PARALLEL_HPP
+#define FTXUI_SCREEN_PARALLEL_HPP
+
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+
+namespace ftxui {
+namespace parallel {
+
+// Start a pool of |threads| worker threads, or stop it when |threads| is 0.
+// See ftxui::SetParallelLayout().
+void SetThreads(int threads);
+
+// Whether |size| items are worth being processed concurrently. This is false
+// unless the thread pool has been started.
+bool Enabled(size_t size);
+
+// Call fn(i) for every i in [0, size), using the thread pool. The calling
+// thread takes part and returns once every call completed.
+void RunConcurrently(size_t size, const std::function<void(size_t)>& fn);
+
+// Call fn(i) for every i in [0, size). The calls are distributed over the
+// thread pool when |size| is large enough and |allowed| is true.
+template <typename Function>
+void For(size_t size, Function fn, bool allowed = true) {
+  if (allowed && Enabled(size)) {
+    RunConcurrently(size, fn);
+    return;
+  }
+  for (size_t i = 0; i < size; ++i) {
+    fn(i);
+  }
+}
+
+}  // namespace parallel
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_SCREEN_PARALLEL_HPP */
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,135 @@
+#include "ftxui/screen/row_diff.hpp"
+
+#include <cstddef>     // for size_t
+#include <functional>  // for hash
+
+namespace ftxui {
+
+namespace {
+
+// Move the cursor to the beginning of the row |y|.
+std::string MoveTo(int y, int x = 1) {
+  return "\x1B[" + std::to_string(y + 1) + ";" + std::to_string(x) + "H";
+}
+
+struct Scroll {
+  int shift = 0;  // Positive when the content moves up.
+  int begin = 0;  // The rows [begin, end) of |next| come from |previous|.
+  int end = 0;
+  int gain = 0;  // The number of rows not written anymore.
+};
+
+}  // namespace
+
+std::string DiffRows(const std::vector<std::string>& previous,
+                     const std::vector<std::string>& next,
+                     int dimx) {
+  const int dimy = int(next.size());
+  std::string out;
+
+  // Nothing to reuse, draw everything.
+  if (previous.size() != next.size()) {
+    out += MoveTo(0);
+    for (int y = 0; y < dimy; ++y) {
+      if (y != 0) {
+        out += "\r\n";
+      }
+      out += next[y];
+    }
+    return out;
+  }
+
+  std::vector<size_t> previous_hash(dimy);
+  std::vector<size_t> next_hash(dimy);
+  for (int y = 0; y < dimy; ++y) {
+    previous_hash[y] = std::hash<std::string>()(previous[y]);
+    next_hash[y] = std::hash<std::string>()(next[y]);
+  }
+  auto same = [&](int y_next, int y_previous) {
+    return next_hash[y_next] == previous_hash[y_previous] &&
+           next[y_next] == previous[y_previous];
+  };
+
+  // Find the scroll saving the most rows. Every maximal run of rows matching
+  // the previous frame shifted by |shift| is a candidate. The rows exposed by
+  // the scroll are blank, and must be written again, even if they were
+  // already up to date.
+  Scroll best;
+  for (int shift = 1 - dimy; shift < dimy; ++shift) {
+    if (shift == 0) {
+      continue;
+    }
+    const int y_begin = shift > 0 ? 0 : -shift;
+    const int y_end = shift > 0 ? dimy - shift : dimy;
+    int y = y_begin;
+    while (y < y_end) {
+      if (!same(y, y + shift)) {
+        ++y;
+        continue;
+      }
+      Scroll scroll;
+      scroll.shift = shift;
+      scroll.begin = y;
+      for (; y < y_end && same(y, y + shift); ++y) {
+        if (!same(y, y)) {
+          scroll.gain++;
+        }
+      }
+      scroll.end = y;
+      const int exposed_begin = shift > 0 ? scroll.end : scroll.begin + shift;
+      const int exposed_end = shift > 0 ? scroll.end + shift : scroll.begin;
+      for (int exposed = exposed_begin; exposed < exposed_end; ++exposed) {
+        if (same(exposed, exposed)) {
+          scroll.gain--;
+        }
+      }
+      if (scroll.gain > best.gain) {
+        best = scroll;
+      }
+    }
+  }
+
+  // What the terminal displays. nullptr for blank rows.
+  std::vector<const std::string*> displayed(dimy);
+  for (int y = 0; y < dimy; ++y) {
+    displayed[y] = &previous[y];
+  }
+
+  if (best.gain > 0) {
+    // The region moving, including the rows exposed.
+    const int top = best.shift > 0 ? best.begin : best.begin + best.shift;
+    const int bottom = best.shift > 0 ? best.end + best.shift : best.end;
+    out += "\x1B[" + std::to_string(top + 1) + ";" + std::to_string(bottom) +
+           "r";  // DECSTBM
+    if (best.shift > 0) {
+      out += "\x1B[" + std::to_string(best.shift) + "S";  // SU
+    } else {
+      out += "\x1B[" + std::to_string(-best.shift) + "T";  // SD
+    }
+    out += "\x1B[r";  // Reset the scroll region.
+
+    for (int y = top; y < bottom; ++y) {
+      displayed[y] = nullptr;
+    }
+    for (int y = best.begin; y < best.end; ++y) {
+      displayed[y] = &previous[y + best.shift];
+    }
+  }
+
+  for (int y = 0; y < dimy; ++y) {
+    if (displayed[y] == nullptr || *displayed[y] != next[y]) {
+      out += MoveTo(y);
+      out += next[y];
+    }
+  }
+  if (dimy != 0) {
+    out += MoveTo(dimy - 1, dimx);
+  }
+  return out;
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
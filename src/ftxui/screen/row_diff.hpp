@@ -0,0 +1,27 @@
+#ifndef FTXUI_SCREEN_ROW_DIFF_HPP
+#define FTXUI_SCREEN_ROW_DIFF_HPP
+
+#include <string>  // for string
+#include <vector>  // for vector
+
+namespace ftxui {
+
+// Produce the string updating a terminal displaying the rows |previous| to
+// display the rows |next|. Rows are encoded with Screen::RowToString and are
+// displayed from the top-left corner of the terminal.
+//
+// When a range of rows moved vertically, it is scrolled using a scroll region
+// (DECSTBM + SU/SD). Then, only the rows differing from what the terminal
+// displays are written. The cursor is left at the end of the last row, like
+// after Screen::ToString().
+std::string DiffRows(const std::vector<std::string>& previous,
+                     const std::vector<std::string>& next,
+                     int dimx);
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_ROW_DIFF_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,57 @@
+#include "ftxui/screen/row_diff.hpp"
+
+#include <gtest/gtest.h>
+#include <string>  // for string
+#include <vector>  // for vector
+
+namespace ftxui {
+
+TEST(RowDiffTest, FirstFrame) {
+  EXPECT_EQ(DiffRows({}, {"a", "b"}, 1), "\x1B[1;1Ha\r\nb");
+}
+
+TEST(RowDiffTest, Unchanged) {
+  EXPECT_EQ(DiffRows({"a", "b"}, {"a", "b"}, 1), "\x1B[2;1H");
+}
+
+TEST(RowDiffTest, ChangedRow) {
+  EXPECT_EQ(DiffRows({"a", "b", "c"}, {"a", "x", "c"}, 1),
+            "\x1B[2;1Hx"
+            "\x1B[3;1H");
+}
+
+TEST(RowDiffTest, ScrollUp) {
+  // A log view scrolling by one line, above a status bar.
+  EXPECT_EQ(DiffRows({"1", "2", "3", "4", "s"},  //
+                     {"2", "3", "4", "5", "s"}, 1),
+            "\x1B[1;4r"  // Scroll region: rows 1 to 4.
+            "\x1B[1S"    // Scroll up by one row.
+            "\x1B[r"
+            "\x1B[4;1H5"  // The row exposed.
+            "\x1B[5;1H");
+}
+
+TEST(RowDiffTest, ScrollDown) {
+  EXPECT_EQ(DiffRows({"t", "1", "2", "3", "4"},  //
+                     {"t", "0", "0", "1", "2"}, 1),
+            "\x1B[2;5r"
+            "\x1B[2T"
+            "\x1B[r"
+            "\x1B[2;1H0"
+            "\x1B[3;1H0"
+            "\x1B[5;1H");
+}
+
+TEST(RowDiffTest, NoScrollWhenNothingIsSaved) {
+  // Scrolling up would save the first row, but would expose the second one,
+  // which is already up to date.
+  EXPECT_EQ(DiffRows({"a", "b", "c"}, {"b", "b", "c"}, 1),
+            "\x1B[1;1Hb"
+            "\x1B[3;1H");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,13 +1,16 @@
-#include <cstdint>  // for uint8_t
-#include <iostream>  // for operator<<, stringstream, basic_ostream, flush, cout, ostream
-#include <map>      // for _Rb_tree_const_iterator, map, operator!=, operator==
-#include <memory>   // for allocator
-#include <sstream>  // IWYU pragma: keep
-#include <utility>  // for pair
-
+#include <algorithm>  // for min, max, sort
+#include <array>      // for array
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t, uint16_t
+#include <memory>     // for allocator
+#include <mutex>      // for mutex, lock_guard
+#include <sstream>    // IWYU pragma: keep
+#include <utility>    // for pair
+
+#include "ftxui/screen/parallel.hpp"  // for Enabled, RunConcurrently
 #include "ftxui/screen/screen.hpp"
 #include "ftxui/screen/string.hpp"    // for string_width
-#include "ftxui/screen/terminal.hpp"  // for Dimensions, Size
+#include "ftxui/screen/terminal.hpp"  // for Dimensions, Size, Write
 
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
@@ -49,300 +52,337 @@ void WindowsEmulateVT100Terminal() {
 }
 #endif
 
-void UpdatePixelStyle(std::stringstream& ss,
-                      Pixel& previous,
-                      const Pixel& next) {
+void UpdatePixelStyle(std::string& out, Pixel& previous, const Pixel& next) {
   if (next == previous) {
     return;
   }
 
   if (next.bold && !previous.bold) {
-    ss << "\x1B[1m";  // BOLD_SET
+    out += "\x1B[1m";  // BOLD_SET
   }
 
   if (!next.bold && previous.bold) {
-    ss << "\x1B[22m";  // BOLD_RESET
+    out += "\x1B[22m";  // BOLD_RESET
   }
 
   if (next.dim && !previous.dim) {
-    ss << "\x1B[2m";  // DIM_SET
+    out += "\x1B[2m";  // DIM_SET
   }
 
   if (!next.dim && previous.dim) {
-    ss << "\x1B[22m";  // DIM_RESET
+    out += "\x1B[22m";  // DIM_RESET
   }
 
   if (next.underlined && !previous.underlined) {
-    ss << "\x1B[4m";  // UNDERLINED_SET
+    out += "\x1B[4m";  // UNDERLINED_SET
   }
 
   if (!next.underlined && previous.underlined) {
-    ss << "\x1B[24m";  // UNDERLINED_RESET
+    out += "\x1B[24m";  // UNDERLINED_RESET
   }
 
   if (next.blink && !previous.blink) {
-    ss << "\x1B[5m";  // BLINK_SET
+    out += "\x1B[5m";  // BLINK_SET
   }
 
   if (!next.blink && previous.blink) {
-    ss << "\x1B[25m";  // BLINK_RESET
+    out += "\x1B[25m";  // BLINK_RESET
   }
 
   if (next.inverted && !previous.inverted) {
-    ss << "\x1B[7m";  // INVERTED_SET
+    out += "\x1B[7m";  // INVERTED_SET
   }
 
   if (!next.inverted && previous.inverted) {
-    ss << "\x1B[27m";  // INVERTED_RESET
+    out += "\x1B[27m";  // INVERTED_RESET
   }
 
   if (next.foreground_color != previous.foreground_color ||
       next.background_color != previous.background_color) {
-    ss << "\x1B[" + next.foreground_color.Print(false) + "m";
-    ss << "\x1B[" + next.background_color.Print(true) + "m";
+    out += "\x1B[";
+    next.foreground_color.PrintTo(out, false);
+    out += "m\x1B[";
+    next.background_color.PrintTo(out, true);
+    out += 'm';
   }
 
   previous = next;
 }
 
-struct TileEncoding {
-  uint8_t left : 2;
-  uint8_t top : 2;
-  uint8_t right : 2;
-  uint8_t down : 2;
-  uint8_t round : 1;
-
-  // clang-format off
-  bool operator<(const TileEncoding& other) const {
-    if (left < other.left)   { return  true;  }
-    if (left > other.left)   { return  false; }
-    if (top < other.top)     { return  true;  }
-    if (top > other.top)     { return  false; }
-    if (right < other.right) { return  true;  }
-    if (right > other.right) { return  false; }
-    if (down < other.down)   { return  true;  }
-    if (down > other.down)   { return  false; }
-    if (round < other.round) { return  true;  }
-    if (round > other.round) { return  false; }
-      return false;
+// Encode a row. It starts and ends with the default style, so that rows can be
+// encoded independently.
+void EncodeRow(std::string& out, const std::vector<Pixel>& row) {
+  const Pixel final_pixel;
+  Pixel previous_pixel;
+  bool previous_fullwidth = false;
+  for (const auto& pixel : row) {
+    if (!previous_fullwidth) {
+      UpdatePixelStyle(out, previous_pixel, pixel);
+      out += pixel.character;
+    }
+    previous_fullwidth = (string_width(pixel.character) == 2);
+  }
+  UpdatePixelStyle(out, previous_pixel, final_pixel);
+}
+
+// Encode the rows [y_begin, y_end).
+void EncodeRows(std::string& out,
+                const std::vector<std::vector<Pixel>>& pixels,
+                size_t y_begin,
+                size_t y_end) {
+  for (size_t y = y_begin; y < y_end; ++y) {
+    if (y != 0) {
+      out += "\r\n";
+    }
+    EncodeRow(out, pixels[y]);
   }
-  // clang-format on
+}
+
+// A box drawing character, described by the weight of its four branches:
+// 0: none, 1: light, 2: heavy, 3: double.
+struct Tile {
+  const char* character;
+  uint8_t left;
+  uint8_t top;
+  uint8_t right;
+  uint8_t down;
+  bool round;
 };
 
 // clang-format off
-const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
-    {"─", {1, 0, 1, 0, 0}},
-    {"━", {2, 0, 2, 0, 0}},
-
-    {"│", {0, 1, 0, 1, 0}},
-    {"┃", {0, 2, 0, 2, 0}},
-
-    {"┌", {0, 0, 1, 1, 0}},
-    {"┍", {0, 0, 2, 1, 0}},
-    {"┎", {0, 0, 1, 2, 0}},
-    {"┏", {0, 0, 2, 2, 0}},
-
-    {"┐", {1, 0, 0, 1, 0}},
-    {"┑", {2, 0, 0, 1, 0}},
-    {"┒", {1, 0, 0, 2, 0}},
-    {"┓", {2, 0, 0, 2, 0}},
-
-    {"└", {0, 1, 1, 0, 0}},
-    {"┕", {0, 1, 2, 0, 0}},
-    {"┖", {0, 2, 1, 0, 0}},
-    {"┗", {0, 2, 2, 0, 0}},
-
-    {"┘", {1, 1, 0, 0, 0}},
-    {"┙", {2, 1, 0, 0, 0}},
-    {"┚", {1, 2, 0, 0, 0}},
-    {"┛", {2, 2, 0, 0, 0}},
-
-    {"├", {0, 1, 1, 1, 0}},
-    {"┝", {0, 1, 2, 1, 0}},
-    {"┞", {0, 2, 1, 1, 0}},
-    {"┟", {0, 1, 1, 2, 0}},
-    {"┠", {0, 2, 1, 2, 0}},
-    {"┡", {0, 2, 2, 1, 0}},
-    {"┢", {0, 1, 2, 2, 0}},
-    {"┣", {0, 2, 2, 2, 0}},
-
-    {"┤", {1, 1, 0, 1, 0}},
-    {"┥", {2, 1, 0, 1, 0}},
-    {"┦", {1, 2, 0, 1, 0}},
-    {"┧", {1, 1, 0, 2, 0}},
-    {"┨", {1, 2, 0, 2, 0}},
-    {"┩", {2, 2, 0, 1, 0}},
-    {"┪", {2, 1, 0, 2, 0}},
-    {"┫", {2, 2, 0, 2, 0}},
-
-    {"┬", {1, 0, 1, 1, 0}},
-    {"┭", {2, 0, 1, 1, 0}},
-    {"┮", {1, 0, 2, 1, 0}},
-    {"┯", {2, 0, 2, 1, 0}},
-    {"┰", {1, 0, 1, 2, 0}},
-    {"┱", {2, 0, 1, 2, 0}},
-    {"┲", {1, 0, 2, 2, 0}},
-    {"┳", {2, 0, 2, 2, 0}},
-
-    {"┴", {1, 1, 1, 0, 0}},
-    {"┵", {2, 1, 1, 0, 0}},
-    {"┶", {1, 1, 2, 0, 0}},
-    {"┷", {2, 1, 2, 0, 0}},
-    {"┸", {1, 2, 1, 0, 0}},
-    {"┹", {2, 2, 1, 0, 0}},
-    {"┺", {1, 2, 2, 0, 0}},
-    {"┻", {2, 2, 2, 0, 0}},
-
-    {"┼", {1, 1, 1, 1, 0}},
-    {"┽", {2, 1, 1, 1, 0}},
-    {"┾", {1, 1, 2, 1, 0}},
-    {"┿", {2, 1, 2, 1, 0}},
-    {"╀", {1, 2, 1, 1, 0}},
-    {"╁", {1, 1, 1, 2, 0}},
-    {"╂", {1, 2, 1, 2, 0}},
-    {"╃", {2, 2, 1, 1, 0}},
-    {"╄", {1, 2, 2, 1, 0}},
-    {"╅", {2, 1, 1, 2, 0}},
-    {"╆", {1, 1, 2, 2, 0}},
-    {"╇", {2, 2, 2, 1, 0}},
-    {"╈", {2, 1, 2, 2, 0}},
-    {"╉", {2, 2, 1, 2, 0}},
-    {"╊", {1, 2, 2, 2, 0}},
-    {"╋", {2, 2, 2, 2, 0}},
-
-    {"═", {3, 0, 3, 0, 0}},
-    {"║", {0, 3, 0, 3, 0}},
-
-    {"╒", {0, 0, 3, 1, 0}},
-    {"╓", {0, 0, 1, 3, 0}},
-    {"╔", {0, 0, 3, 3, 0}},
-
-    {"╕", {3, 0, 0, 1, 0}},
-    {"╖", {1, 0, 0, 3, 0}},
-    {"╗", {3, 0, 0, 3, 0}},
-
-    {"╘", {0, 1, 3, 0, 0}},
-    {"╙", {0, 3, 1, 0, 0}},
-    {"╚", {0, 3, 3, 0, 0}},
-
-    {"╛", {3, 1, 0, 0, 0}},
-    {"╜", {1, 3, 0, 0, 0}},
-    {"╝", {3, 3, 0, 0, 0}},
-
-    {"╞", {0, 1, 3, 1, 0}},
-    {"╟", {0, 3, 1, 3, 0}},
-    {"╠", {0, 3, 3, 3, 0}},
-
-    {"╡", {3, 1, 0, 1, 0}},
-    {"╢", {1, 3, 0, 3, 0}},
-    {"╣", {3, 3, 0, 3, 0}},
-
-    {"╤", {3, 0, 3, 1, 0}},
-    {"╥", {1, 0, 1, 3, 0}},
-    {"╦", {3, 0, 3, 3, 0}},
-
-    {"╧", {3, 1, 3, 0, 0}},
-    {"╨", {1, 3, 1, 0, 0}},
-    {"╩", {3, 3, 3, 0, 0}},
-
-    {"╪", {3, 1, 3, 1, 0}},
-    {"╫", {1, 3, 1, 3, 0}},
-    {"╬", {3, 3, 3, 3, 0}},
-
-    {"╭", {0, 0, 1, 1, 1}},
-    {"╮", {1, 0, 0, 1, 1}},
-    {"╯", {1, 1, 0, 0, 1}},
-    {"╰", {0, 1, 1, 0, 1}},
-
-    {"╴", {1, 0, 0, 0, 0}},
-    {"╵", {0, 1, 0, 0, 0}},
-    {"╶", {0, 0, 1, 0, 0}},
-    {"╷", {0, 0, 0, 1, 0}},
-
-    {"╸", {2, 0, 0, 0, 0}},
-    {"╹", {0, 2, 0, 0, 0}},
-    {"╺", {0, 0, 2, 0, 0}},
-    {"╻", {0, 0, 0, 2, 0}},
-
-    {"╼", {1, 0, 2, 0, 0}},
-    {"╽", {0, 1, 0, 2, 0}},
-    {"╾", {2, 0, 1, 0, 0}},
-    {"╿", {0, 2, 0, 1, 0}},
+constexpr Tile kTiles[] = {
+    {"─", 1, 0, 1, 0, false},
+    {"━", 2, 0, 2, 0, false},
+
+    {"│", 0, 1, 0, 1, false},
+    {"┃", 0, 2, 0, 2, false},
+
+    {"┌", 0, 0, 1, 1, false},
+    {"┍", 0, 0, 2, 1, false},
+    {"┎", 0, 0, 1, 2, false},
+    {"┏", 0, 0, 2, 2, false},
+
+    {"┐", 1, 0, 0, 1, false},
+    {"┑", 2, 0, 0, 1, false},
+    {"┒", 1, 0, 0, 2, false},
+    {"┓", 2, 0, 0, 2, false},
+
+    {"└", 0, 1, 1, 0, false},
+    {"┕", 0, 1, 2, 0, false},
+    {"┖", 0, 2, 1, 0, false},
+    {"┗", 0, 2, 2, 0, false},
+
+    {"┘", 1, 1, 0, 0, false},
+    {"┙", 2, 1, 0, 0, false},
+    {"┚", 1, 2, 0, 0, false},
+    {"┛", 2, 2, 0, 0, false},
+
+    {"├", 0, 1, 1, 1, false},
+    {"┝", 0, 1, 2, 1, false},
+    {"┞", 0, 2, 1, 1, false},
+    {"┟", 0, 1, 1, 2, false},
+    {"┠", 0, 2, 1, 2, false},
+    {"┡", 0, 2, 2, 1, false},
+    {"┢", 0, 1, 2, 2, false},
+    {"┣", 0, 2, 2, 2, false},
+
+    {"┤", 1, 1, 0, 1, false},
+    {"┥", 2, 1, 0, 1, false},
+    {"┦", 1, 2, 0, 1, false},
+    {"┧", 1, 1, 0, 2, false},
+    {"┨", 1, 2, 0, 2, false},
+    {"┩", 2, 2, 0, 1, false},
+    {"┪", 2, 1, 0, 2, false},
+    {"┫", 2, 2, 0, 2, false},
+
+    {"┬", 1, 0, 1, 1, false},
+    {"┭", 2, 0, 1, 1, false},
+    {"┮", 1, 0, 2, 1, false},
+    {"┯", 2, 0, 2, 1, false},
+    {"┰", 1, 0, 1, 2, false},
+    {"┱", 2, 0, 1, 2, false},
+    {"┲", 1, 0, 2, 2, false},
+    {"┳", 2, 0, 2, 2, false},
+
+    {"┴", 1, 1, 1, 0, false},
+    {"┵", 2, 1, 1, 0, false},
+    {"┶", 1, 1, 2, 0, false},
+    {"┷", 2, 1, 2, 0, false},
+    {"┸", 1, 2, 1, 0, false},
+    {"┹", 2, 2, 1, 0, false},
+    {"┺", 1, 2, 2, 0, false},
+    {"┻", 2, 2, 2, 0, false},
+
+    {"┼", 1, 1, 1, 1, false},
+    {"┽", 2, 1, 1, 1, false},
+    {"┾", 1, 1, 2, 1, false},
+    {"┿", 2, 1, 2, 1, false},
+    {"╀", 1, 2, 1, 1, false},
+    {"╁", 1, 1, 1, 2, false},
+    {"╂", 1, 2, 1, 2, false},
+    {"╃", 2, 2, 1, 1, false},
+    {"╄", 1, 2, 2, 1, false},
+    {"╅", 2, 1, 1, 2, false},
+    {"╆", 1, 1, 2, 2, false},
+    {"╇", 2, 2, 2, 1, false},
+    {"╈", 2, 1, 2, 2, false},
+    {"╉", 2, 2, 1, 2, false},
+    {"╊", 1, 2, 2, 2, false},
+    {"╋", 2, 2, 2, 2, false},
+
+    {"═", 3, 0, 3, 0, false},
+    {"║", 0, 3, 0, 3, false},
+
+    {"╒", 0, 0, 3, 1, false},
+    {"╓", 0, 0, 1, 3, false},
+    {"╔", 0, 0, 3, 3, false},
+
+    {"╕", 3, 0, 0, 1, false},
+    {"╖", 1, 0, 0, 3, false},
+    {"╗", 3, 0, 0, 3, false},
+
+    {"╘", 0, 1, 3, 0, false},
+    {"╙", 0, 3, 1, 0, false},
+    {"╚", 0, 3, 3, 0, false},
+
+    {"╛", 3, 1, 0, 0, false},
+    {"╜", 1, 3, 0, 0, false},
+    {"╝", 3, 3, 0, 0, false},
+
+    {"╞", 0, 1, 3, 1, false},
+    {"╟", 0, 3, 1, 3, false},
+    {"╠", 0, 3, 3, 3, false},
+
+    {"╡", 3, 1, 0, 1, false},
+    {"╢", 1, 3, 0, 3, false},
+    {"╣", 3, 3, 0, 3, false},
+
+    {"╤", 3, 0, 3, 1, false},
+    {"╥", 1, 0, 1, 3, false},
+    {"╦", 3, 0, 3, 3, false},
+
+    {"╧", 3, 1, 3, 0, false},
+    {"╨", 1, 3, 1, 0, false},
+    {"╩", 3, 3, 3, 0, false},
+
+    {"╪", 3, 1, 3, 1, false},
+    {"╫", 1, 3, 1, 3, false},
+    {"╬", 3, 3, 3, 3, false},
+
+    {"╭", 0, 0, 1, 1, true},
+    {"╮", 1, 0, 0, 1, true},
+    {"╯", 1, 1, 0, 0, true},
+    {"╰", 0, 1, 1, 0, true},
+
+    {"╴", 1, 0, 0, 0, false},
+    {"╵", 0, 1, 0, 0, false},
+    {"╶", 0, 0, 1, 0, false},
+    {"╷", 0, 0, 0, 1, false},
+
+    {"╸", 2, 0, 0, 0, false},
+    {"╹", 0, 2, 0, 0, false},
+    {"╺", 0, 0, 2, 0, false},
+    {"╻", 0, 0, 0, 2, false},
+
+    {"╼", 1, 0, 2, 0, false},
+    {"╽", 0, 1, 0, 2, false},
+    {"╾", 2, 0, 1, 0, false},
+    {"╿", 0, 2, 0, 1, false},
 };
 // clang-format on
 
-template <class A, class B>
-std::map<B, A> InvertMap(const std::map<A, B> input) {
-  std::map<B, A> output;
-  for (const auto& it : input) {
-    output[it.second] = it.first;
-  }
-  return output;
+// The branches of a tile packed into 8 bits: 2 bits per branch.
+constexpr int kLeft = 0;
+constexpr int kTop = 2;
+constexpr int kRight = 4;
+constexpr int kDown = 6;
+constexpr uint16_t kRound = 1U << 8U;
+constexpr uint16_t kNotATile = 1U << 9U;
+
+constexpr int Branch(uint16_t code, int branch) {
+  return (code >> branch) & 3U;  // NOLINT
 }
 
-const std::map<TileEncoding, std::string> tile_encoding_inverse =  // NOLINT
-    InvertMap(tile_encoding);
+constexpr uint16_t WithBranch(uint16_t code, int branch, int value) {
+  return uint16_t((code & ~(3U << branch)) | (unsigned(value) << branch));
+}
 
-void UpgradeLeftRight(std::string& left, std::string& right) {
-  const auto it_left = tile_encoding.find(left);
-  if (it_left == tile_encoding.end()) {
-    return;
+constexpr uint16_t Encode(const Tile& tile) {
+  return uint16_t((tile.left << kLeft) | (tile.top << kTop) |
+                  (tile.right << kRight) | (tile.down << kDown) |
+                  (tile.round ? kRound : 0U));
+}
+
+// The box drawing block U+2500-U+257F is encoded as E2 94 80-BF, E2 95 80-BF.
+constexpr int BoxDrawingIndex(const char* c) {
+  return (uint8_t(c[1]) - 0x94) * 64 + (uint8_t(c[2]) - 0x80);  // NOLINT
+}
+
+// The code of every character of the box drawing block.
+constexpr std::array<uint16_t, 128> BuildCodes() {
+  std::array<uint16_t, 128> codes = {};
+  for (auto& code : codes) {
+    code = kNotATile;
   }
-  const auto it_right = tile_encoding.find(right);
-  if (it_right == tile_encoding.end()) {
-    return;
+  for (const Tile& tile : kTiles) {
+    codes[BoxDrawingIndex(tile.character)] = Encode(tile);  // NOLINT
   }
+  return codes;
+}
 
-  if (it_left->second.right == 0 && it_right->second.left != 0) {
-    TileEncoding encoding_left = it_left->second;
-    encoding_left.right = it_right->second.left;
-    const auto it_left_upgrade = tile_encoding_inverse.find(encoding_left);
-    if (it_left_upgrade != tile_encoding_inverse.end()) {
-      left = it_left_upgrade->second;
+// The character of every square tile, or nullptr.
+constexpr std::array<const char*, 256> BuildCharacters() {
+  std::array<const char*, 256> characters = {};
+  for (const Tile& tile : kTiles) {
+    if (!tile.round) {
+      characters[Encode(tile)] = tile.character;  // NOLINT
     }
   }
+  return characters;
+}
 
-  if (it_right->second.left == 0 && it_left->second.right != 0) {
-    TileEncoding encoding_right = it_right->second;
-    encoding_right.left = it_left->second.right;
-    const auto it_right_upgrade = tile_encoding_inverse.find(encoding_right);
-    if (it_right_upgrade != tile_encoding_inverse.end()) {
-      right = it_right_upgrade->second;
-    }
+constexpr std::array<uint16_t, 128> kCodes = BuildCodes();
+constexpr std::array<const char*, 256> kCharacters = BuildCharacters();
+
+uint16_t Decode(const Pixel& pixel) {
+  const std::string& c = pixel.character;
+  if (!pixel.automerge || c.size() != 3 || uint8_t(c[0]) != 0xE2 ||
+      (uint8_t(c[1]) != 0x94 && uint8_t(c[1]) != 0x95)) {
+    return kNotATile;
   }
+  return kCodes[BoxDrawingIndex(c.data())];  // NOLINT
 }
 
-void UpgradeTopDown(std::string& top, std::string& down) {
-  const auto it_top = tile_encoding.find(top);
-  if (it_top == tile_encoding.end()) {
+// Give the |branch| of |code| the weight of the facing branch of the
+// neighbor, when it has none.
+void Upgrade(Pixel& pixel, uint16_t code, int branch, int value) {
+  if (Branch(code, branch) != 0 || value == 0 || (code & kRound) != 0) {
     return;
   }
-  const auto it_down = tile_encoding.find(down);
-  if (it_down == tile_encoding.end()) {
-    return;
-  }
-
-  if (it_top->second.down == 0 && it_down->second.top != 0) {
-    TileEncoding encoding_top = it_top->second;
-    encoding_top.down = it_down->second.top;
-    const auto it_top_down = tile_encoding_inverse.find(encoding_top);
-    if (it_top_down != tile_encoding_inverse.end()) {
-      top = it_top_down->second;
-    }
+  const char* character = kCharacters[WithBranch(code, branch, value)];
+  if (character != nullptr) {
+    pixel.character = character;
   }
+}
 
-  if (it_down->second.top == 0 && it_top->second.down != 0) {
-    TileEncoding encoding_down = it_down->second;
-    encoding_down.top = it_top->second.down;
-    const auto it_down_top = tile_encoding_inverse.find(encoding_down);
-    if (it_down_top != tile_encoding_inverse.end()) {
-      down = it_down_top->second;
-    }
+void UpgradeLeftRight(Pixel& left, Pixel& right) {
+  const uint16_t code_left = Decode(left);
+  const uint16_t code_right = Decode(right);
+  if (code_left == kNotATile || code_right == kNotATile) {
+    return;
   }
+  Upgrade(left, code_left, kRight, Branch(code_right, kLeft));
+  Upgrade(right, code_right, kLeft, Branch(code_left, kRight));
 }
 
-bool ShouldAttemptAutoMerge(Pixel& pixel) {
-  return pixel.automerge && pixel.character.size() == 3;
+void UpgradeTopDown(Pixel& top, Pixel& down) {
+  const uint16_t code_top = Decode(top);
+  const uint16_t code_down = Decode(down);
+  if (code_top == kNotATile || code_down == kNotATile) {
+    return;
+  }
+  Upgrade(top, code_top, kDown, Branch(code_down, kTop));
+  Upgrade(down, code_down, kTop, Branch(code_top, kDown));
 }
 
 }  // namespace
@@ -404,34 +444,47 @@ Screen::Screen(int dimx, int dimy)
 
 /// Produce a std::string that can be used to print the Screen on the terminal.
 /// Don't forget to flush stdout. Alternatively, you can use Screen::Print();
+///
+/// When the thread pool is enabled (see ftxui::SetParallelLayout), bands of
+/// rows of large screens are encoded concurrently, then concatenated.
 std::string Screen::ToString() {
-  std::stringstream ss;
-
-  Pixel previous_pixel;
-  Pixel final_pixel;
-
-  for (int y = 0; y < dimy_; ++y) {
-    if (y != 0) {
-      UpdatePixelStyle(ss, previous_pixel, final_pixel);
-      ss << "\r\n";
-    }
-    bool previous_fullwidth = false;
-    for (const auto& pixel : pixels_[y]) {
-      if (!previous_fullwidth) {
-        UpdatePixelStyle(ss, previous_pixel, pixel);
-        ss << pixel.character;
-      }
-      previous_fullwidth = (string_width(pixel.character) == 2);
-    }
+  const size_t rows = pixels_.size();
+  if (!parallel::Enabled(rows)) {
+    std::string out;
+    EncodeRows(out, pixels_, 0, rows);
+    return out;
   }
 
-  UpdatePixelStyle(ss, previous_pixel, final_pixel);
+  const size_t band_size = 8;
+  const size_t bands = (rows + band_size - 1) / band_size;
+  std::vector<std::string> encoded(bands);
+  parallel::RunConcurrently(bands, [&](size_t i) {
+    EncodeRows(encoded[i], pixels_, i * band_size,
+               std::min(rows, (i + 1) * band_size));
+  });
+
+  size_t size = 0;
+  for (const auto& band : encoded) {
+    size += band.size();
+  }
+  std::string out;
+  out.reserve(size);
+  for (const auto& band : encoded) {
+    out += band;
+  }
+  return out;
+}
 
-  return ss.str();
+/// @brief Produce the string printing the row |y| on the terminal, without
+/// moving to the next line.
+std::string Screen::RowToString(int y) const {
+  std::string out;
+  EncodeRow(out, pixels_[y]);
+  return out;
 }
 
 void Screen::Print() {
-  std::cout << ToString() << '\0' << std::flush;
+  Terminal::Write(ToString());
 }
 
 /// @brief Access a character a given position.
@@ -492,36 +545,65 @@ void Screen::Clear() {
       cell = Pixel();
     }
   }
+  automerge_.clear();
   cursor_.x = dimx_ - 1;
   cursor_.y = dimy_ - 1;
 }
 
-// clang-format off
+/// @brief Mark the pixels of |box| as box drawing characters, to be merged
+/// with the adjacent ones by ApplyShader(). This can be called by nodes drawn
+/// concurrently.
+/// @param box The area to merge.
+void Screen::MarkAutomerge(Box box) {
+  box = Box::Intersection(box, stencil);
+  if (box.x_min > box.x_max || box.y_min > box.y_max) {
+    return;
+  }
+  for (int y = box.y_min; y <= box.y_max; ++y) {
+    for (int x = box.x_min; x <= box.x_max; ++x) {
+      pixels_[y][x].automerge = true;
+    }
+  }
+  const std::lock_guard<std::mutex> lock(automerge_mutex_.mutex);
+  automerge_.push_back(box);
+}
+
 void Screen::ApplyShader() {
-  // Merge box characters togethers.
-  for (int y = 1; y < dimy_; ++y) {
-    for (int x = 1; x < dimx_; ++x) {
-      // Box drawing character uses exactly 3 byte.
+  // Merge box characters togethers. Only the marked pixels are visited, once,
+  // in the order of the screen.
+  struct Span {
+    int y;
+    int x_min;
+    int x_max;
+    bool operator<(const Span& other) const {
+      return y != other.y ? y < other.y : x_min < other.x_min;
+    }
+  };
+  std::vector<Span> spans;
+  for (const Box& box : automerge_) {
+    for (int y = std::max(box.y_min, 1); y <= box.y_max; ++y) {
+      spans.push_back({y, std::max(box.x_min, 1), box.x_max});
+    }
+  }
+  automerge_.clear();
+  std::sort(spans.begin(), spans.end());
+
+  int y = -1;
+  int x_next = 0;
+  for (const Span& span : spans) {
+    if (span.y != y) {
+      y = span.y;
+      x_next = 0;
+    }
+    for (int x = std::max(span.x_min, x_next); x <= span.x_max; ++x) {
       Pixel& cur = pixels_[y][x];
-      if (!ShouldAttemptAutoMerge(cur)) {
-        continue;
-      }
-
-      Pixel& left = pixels_[y][x-1];
-      Pixel& top = pixels_[y-1][x];
-
-      if (ShouldAttemptAutoMerge(left)) {
-        UpgradeLeftRight(left.character, cur.character);
-      }
-      if (ShouldAttemptAutoMerge(top)) {
-        UpgradeTopDown(top.character, cur.character);
-      }
+      UpgradeLeftRight(pixels_[y][x - 1], cur);
+      UpgradeTopDown(pixels_[y - 1][x], cur);
     }
+    x_next = std::max(x_next, span.x_max + 1);
   }
 }
 
-// clang-format on
-
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
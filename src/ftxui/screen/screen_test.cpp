@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <string>  // for allocator, string
+#include <vector>  // for vector
+
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+
+// Draw |lines| of box drawing characters, and mark the area |box|. Only the
+// marked pixels are visited, even if the others allow merging.
+Screen Draw(const std::vector<std::string>& lines, Box box) {
+  Screen screen(int(lines[0].size()) / 3, int(lines.size()));
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      screen.PixelAt(x, y).character = lines[y].substr(3 * x, 3);
+      screen.PixelAt(x, y).automerge = true;
+    }
+  }
+  screen.MarkAutomerge(box);
+  screen.ApplyShader();
+  return screen;
+}
+
+}  // namespace
+
+TEST(ScreenTest, Automerge) {
+  Screen screen = Draw({"┌─┐", "│││", "└─┘"}, {0, 2, 0, 2});
+  EXPECT_EQ(screen.ToString(), "┌┬┐\r\n│││\r\n└┴┘");
+}
+
+TEST(ScreenTest, AutomergeMixed) {
+  Screen screen = Draw({"┏━┓", "┃│┃", "╰─╯"}, {0, 2, 0, 2});
+  EXPECT_EQ(screen.ToString(), "┏┯┓\r\n┃│┃\r\n╰┴╯");
+}
+
+TEST(ScreenTest, AutomergeRound) {
+  // Rounded corners don't have a variant with more branches.
+  Screen screen = Draw({"─╭─"}, {0, 2, 0, 0});
+  EXPECT_EQ(screen.ToString(), "─╭─");
+}
+
+TEST(ScreenTest, AutomergeOnlyMarked) {
+  Screen screen = Draw({"┌─┐", "│││", "└─┘"}, {0, 2, 2, 2});
+  EXPECT_EQ(screen.ToString(), "┌─┐\r\n│││\r\n└┴┘");
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,7 +1,14 @@
-#include <cstdlib>  // for getenv
-#include <string>   // for string, allocator
+#include <cerrno>       // for errno, EINTR, EAGAIN
+#include <chrono>       // for milliseconds, steady_clock
+#include <cstdio>       // for fflush, stdout
+#include <cstdlib>      // for getenv
+#include <iostream>     // for cout, flush
+#include <string>       // for string, allocator
+#include <string_view>  // for string_view
+#include <utility>      // for move
 
 #include "ftxui/screen/terminal.hpp"
+#include "ftxui/screen/terminal_probe.hpp"  // for ParseTerminalProbe, ...
 
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
@@ -11,9 +18,14 @@
 #endif
 
 #include <Windows.h>
+#include <io.h>  // for _write
 #else
-#include <sys/ioctl.h>  // for winsize, ioctl, TIOCGWINSZ
-#include <unistd.h>     // for STDOUT_FILENO
+#include <sys/ioctl.h>   // for winsize, ioctl, TIOCGWINSZ
+#include <poll.h>        // for poll, pollfd, POLLOUT
+#include <sys/select.h>  // for select, FD_SET, FD_ZERO, fd_set, timeval
+#include <sys/stat.h>    // for mkdir
+#include <termios.h>     // for tcsetattr, tcgetattr, termios, ECHO, ICANON
+#include <unistd.h>      // for STDOUT_FILENO, STDIN_FILENO, isatty, read
 #endif
 
 namespace ftxui {
@@ -22,6 +34,37 @@ namespace {
 
 bool g_cached = false;                     // NOLINT
 Terminal::Color g_cached_supported_color;  // NOLINT
+bool g_synchronized_output = false;        // NOLINT
+
+Terminal::Output& OutputSink() {
+  static Terminal::Output g_output;
+  return g_output;
+}
+
+// Write all of |data| to |fd|, resuming after partial writes and interrupts.
+void WriteAll(int fd, std::string_view data) {
+  // Output written through the C and C++ streams comes first.
+  std::fflush(stdout);
+  while (!data.empty()) {
+#if defined(_WIN32)
+    const int written = _write(fd, data.data(), unsigned(data.size()));
+#else
+    const ssize_t written = write(fd, data.data(), data.size());
+    if (written < 0 && errno == EAGAIN) {
+      pollfd descriptor = {fd, POLLOUT, 0};
+      poll(&descriptor, 1, -1);
+      continue;
+    }
+#endif
+    if (written < 0 && errno == EINTR) {
+      continue;
+    }
+    if (written <= 0) {
+      return;
+    }
+    data.remove_prefix(size_t(written));
+  }
+}
 
 Dimensions& FallbackSize() {
 #if defined(__EMSCRIPTEN__)
@@ -78,6 +121,88 @@ Terminal::Color ComputeColorSupport() {
   return Terminal::Color::Palette16;
 }
 
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+// The directory of the cache, created if needed: $XDG_CACHE_HOME/ftxui or
+// $HOME/.cache/ftxui.
+std::string CacheFile() {
+  std::string directory = Safe(std::getenv("XDG_CACHE_HOME"));  // NOLINT
+  if (directory.empty()) {
+    const std::string home = Safe(std::getenv("HOME"));  // NOLINT
+    if (home.empty()) {
+      return "";
+    }
+    directory = home + "/.cache";
+    mkdir(directory.c_str(), 0755);  // NOLINT
+  }
+  directory += "/ftxui";
+  mkdir(directory.c_str(), 0755);  // NOLINT
+  return directory + "/terminal_capabilities";
+}
+
+// Collect the replies into |reply| until DA1 is answered, or |deadline|.
+void ReadReplies(std::string& reply,
+                 std::chrono::steady_clock::time_point deadline) {
+  while (!TerminalProbeComplete(reply)) {
+    const auto remaining =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            deadline - std::chrono::steady_clock::now())
+            .count();
+    if (remaining <= 0) {
+      return;
+    }
+    fd_set fds;
+    FD_ZERO(&fds);                // NOLINT
+    FD_SET(STDIN_FILENO, &fds);   // NOLINT
+    timeval tv = {0, 0};
+    tv.tv_sec = remaining / 1000000;   // NOLINT
+    tv.tv_usec = remaining % 1000000;  // NOLINT
+    if (select(STDIN_FILENO + 1, &fds, nullptr, nullptr, &tv) <= 0) {
+      return;
+    }
+    char buffer[256];  // NOLINT
+    const ssize_t size = read(STDIN_FILENO, buffer, sizeof(buffer));
+    if (size <= 0) {
+      return;
+    }
+    reply.append(buffer, size);
+  }
+}
+
+// Send the queries, and collect the replies until DA1 is answered, or the
+// timeout expires.
+std::string QueryTerminal(int timeout_ms) {
+  termios original{};
+  if (tcgetattr(STDIN_FILENO, &original) != 0) {
+    return "";
+  }
+  termios raw = original;
+  raw.c_lflag &= ~(ICANON | ECHO);  // NOLINT
+  raw.c_cc[VMIN] = 0;
+  raw.c_cc[VTIME] = 0;
+  tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+
+  const std::string query = TerminalProbeQuery();
+  std::string reply;
+  if (write(STDOUT_FILENO, query.data(), query.size()) ==
+      static_cast<ssize_t>(query.size())) {
+    const auto timeout = std::chrono::milliseconds(timeout_ms);
+    ReadReplies(reply, std::chrono::steady_clock::now() + timeout);
+
+    // The replies still in flight would be read as key presses by the
+    // application. Wait for them a little longer, then discard the rest.
+    if (!TerminalProbeComplete(reply)) {
+      ReadReplies(reply, std::chrono::steady_clock::now() + timeout);
+    }
+    if (!TerminalProbeComplete(reply)) {
+      tcflush(STDIN_FILENO, TCIFLUSH);
+    }
+  }
+
+  tcsetattr(STDIN_FILENO, TCSANOW, &original);
+  return reply;
+}
+#endif
+
 }  // namespace
 
 namespace Terminal {
@@ -128,6 +253,92 @@ void SetColorSupport(Color color) {
   g_cached_supported_color = color;
 }
 
+/// @brief Redirect the output of the terminal, for instance into a log or a
+/// remote connection. The function receives whole frames.
+/// @param output the function receiving the bytes. An empty function restores
+/// the default, the standard output.
+void SetOutput(Output output) {
+  OutputSink() = std::move(output);
+}
+
+/// @brief Write the output of the terminal to a file descriptor, using
+/// unbuffered writes.
+void SetOutputFileDescriptor(int fd) {
+  OutputSink() = [fd](std::string_view data) { WriteAll(fd, data); };
+}
+
+/// @brief Write |data| to the output of the terminal. See `SetOutput`.
+void Write(std::string_view data) {
+  if (OutputSink()) {
+    OutputSink()(data);
+    return;
+  }
+#if defined(__EMSCRIPTEN__)
+  // Emscripten doesn't implement flush. We interpret zero as flush.
+  std::cout << data << '\0' << std::flush;
+#elif defined(_WIN32)
+  WriteAll(1, data);
+#else
+  WriteAll(STDOUT_FILENO, data);
+#endif
+}
+
+/// @brief Whether the terminal supports the synchronized output mode (?2026).
+/// This is only known after `Terminal::Probe()`, or set manually.
+bool SynchronizedOutputSupport() {
+  return g_synchronized_output;
+}
+
+void SetSynchronizedOutputSupport(bool supported) {
+  g_synchronized_output = supported;
+}
+
+/// @brief Ask the terminal for its capabilities, instead of guessing them from
+/// the environment. This upgrades `ColorSupport()` and sets
+/// `SynchronizedOutputSupport()`.
+///
+/// This must be called before reading the terminal input, for instance before
+/// starting a ScreenInteractive loop. The results are cached into
+/// $XDG_CACHE_HOME/ftxui/terminal_capabilities, keyed by the terminal
+/// identity, so the following launches don't wait for the terminal again.
+///
+/// @param timeout_ms how long to wait for the terminal's reply.
+/// @param use_cache whether the cached results can be used.
+/// @return whether the capabilities were obtained from the terminal or the
+/// cache.
+bool Probe(int timeout_ms, bool use_cache) {
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+  (void)timeout_ms;
+  (void)use_cache;
+  return false;
+#else
+  if (!isatty(STDIN_FILENO) || !isatty(STDOUT_FILENO)) {
+    return false;
+  }
+
+  const std::string identity = TerminalIdentity();
+  const std::string file = CacheFile();
+  TerminalCapabilities capabilities;
+  bool known = use_cache && !file.empty() &&
+               ReadTerminalCapabilities(file, identity, &capabilities);
+  if (!known) {
+    const std::string reply = QueryTerminal(timeout_ms);
+    known = TerminalProbeComplete(reply);
+    capabilities = ParseTerminalProbe(reply);
+    // An incomplete reply, from a slow or busy terminal, isn't cached.
+    if (known && !file.empty()) {
+      WriteTerminalCapabilities(file, identity, capabilities);
+    }
+  }
+
+  if (capabilities.color > ColorSupport()) {
+    SetColorSupport(capabilities.color);
+  }
+  SetSynchronizedOutputSupport(capabilities.synchronized_output);
+  return known;
+#endif
+}
+
 }  // namespace Terminal
 }  // namespace ftxui
 
@@ -0,0 +1,236 @@
+#include "ftxui/screen/terminal_probe.hpp"
+
+#include <algorithm>  // for min
+#include <cstdio>     // for remove, rename
+#include <cstdlib>    // for getenv, strtol
+#include <fstream>    // for ifstream, ofstream
+#include <random>     // for random_device
+#include <sstream>    // for stringstream
+#include <string>     // for string, getline, to_string
+#include <vector>     // for vector
+
+namespace ftxui {
+
+namespace {
+
+const char* const kEnvironment[] = {
+    "TERM",        "TERM_PROGRAM", "TERM_PROGRAM_VERSION",
+    "COLORTERM",   "VTE_VERSION",  "KONSOLE_VERSION",
+};
+
+// Variables identifying a session rather than a terminal, like the GUID of a
+// Windows Terminal tab. Only whether they are set matters.
+const char* const kEnvironmentSet[] = {
+    "WT_SESSION",
+};
+
+// The number of terminals remembered by the cache. The least recently probed
+// ones are forgotten.
+constexpr int kMaxCacheEntries = 16;
+
+std::string ToHex(const std::string& input) {
+  const char* digits = "0123456789abcdef";
+  std::string out;
+  for (const unsigned char c : input) {
+    out += digits[c >> 4U];   // NOLINT
+    out += digits[c & 15U];  // NOLINT
+  }
+  return out;
+}
+
+std::string FromHex(const std::string& input) {
+  std::string out;
+  for (size_t i = 0; i + 1 < input.size(); i += 2) {
+    out += char(std::strtol(input.substr(i, 2).c_str(), nullptr, 16));  // NOLINT
+  }
+  return out;
+}
+
+std::string XTGETTCAP(const std::string& name) {
+  return "\x1BP+q" + ToHex(name) + "\x1B\\";
+}
+
+bool IsDigitOrSemicolon(char c) {
+  return (c >= '0' && c <= '9') || c == ';';
+}
+
+// Find the control sequences "\x1B[<prefix><digits or ;><final>" and return
+// their parameters.
+std::vector<std::string> FindCSI(const std::string& reply,
+                                 const std::string& prefix,
+                                 const std::string& final) {
+  std::vector<std::string> out;
+  const std::string begin = "\x1B[" + prefix;
+  size_t start = reply.find(begin);
+  while (start != std::string::npos) {
+    size_t end = start + begin.size();
+    while (end < reply.size() && IsDigitOrSemicolon(reply[end])) {
+      end++;
+    }
+    if (reply.compare(end, final.size(), final) == 0) {
+      out.push_back(reply.substr(start + begin.size(),
+                                 end - start - begin.size()));
+    }
+    start = reply.find(begin, end);
+  }
+  return out;
+}
+
+}  // namespace
+
+std::string TerminalProbeQuery() {
+  return XTGETTCAP("Tc") +      //
+         XTGETTCAP("RGB") +     //
+         XTGETTCAP("colors") +  //
+         "\x1B[?2026$p"         // DECRQM synchronized output.
+         "\x1B[c";              // DA1
+}
+
+bool TerminalProbeComplete(const std::string& reply) {
+  return !FindCSI(reply, "?", "c").empty();
+}
+
+TerminalCapabilities ParseTerminalProbe(const std::string& reply) {
+  TerminalCapabilities capabilities;
+
+  // XTGETTCAP: "\x1BP1+r<name>=<value>\x1B\\" for the known capabilities.
+  const std::string success = "\x1BP1+r";
+  size_t start = reply.find(success);
+  while (start != std::string::npos) {
+    start += success.size();
+    const size_t end = reply.find("\x1B\\", start);
+    if (end == std::string::npos) {
+      break;
+    }
+    std::stringstream entries(reply.substr(start, end - start));
+    std::string entry;
+    while (std::getline(entries, entry, ';')) {
+      const size_t equal = entry.find('=');
+      const std::string name = FromHex(entry.substr(0, equal));
+      const std::string value =
+          equal == std::string::npos ? "" : FromHex(entry.substr(equal + 1));
+      Terminal::Color color = Terminal::Color::Palette1;
+      if (name == "Tc" || name == "RGB") {
+        color = Terminal::Color::TrueColor;
+      }
+      if (name == "colors") {
+        const long colors = std::strtol(value.c_str(), nullptr, 10);
+        color = colors >= 16777216 ? Terminal::Color::TrueColor   // NOLINT
+                : colors >= 256    ? Terminal::Color::Palette256  // NOLINT
+                : colors >= 8      ? Terminal::Color::Palette16   // NOLINT
+                                   : Terminal::Color::Palette1;
+      }
+      if (color > capabilities.color) {
+        capabilities.color = color;
+      }
+    }
+    start = reply.find(success, end);
+  }
+
+  // DECRQM: "\x1B[?2026;<status>$y". The mode is supported when it is set (1)
+  // or reset (2).
+  for (const auto& parameters : FindCSI(reply, "?", "$y")) {
+    if (parameters == "2026;1" || parameters == "2026;2") {
+      capabilities.synchronized_output = true;
+    }
+  }
+
+  return capabilities;
+}
+
+std::string TerminalIdentity() {
+  std::string identity;
+  for (const char* name : kEnvironment) {
+    const char* value = std::getenv(name);  // NOLINT
+    identity += name;
+    identity += '=';
+    identity += value != nullptr ? value : "";
+    identity += ';';
+  }
+  for (const char* name : kEnvironmentSet) {
+    identity += name;
+    identity += std::getenv(name) != nullptr ? "=1;" : "=0;";  // NOLINT
+  }
+  for (char& c : identity) {
+    if (c == '\t' || c == '\n' || c == '\r') {
+      c = ' ';
+    }
+  }
+  return identity;
+}
+
+bool ReadTerminalCapabilities(const std::string& file,
+                              const std::string& identity,
+                              TerminalCapabilities* capabilities) {
+  std::ifstream input(file);
+  std::string line;
+  while (std::getline(input, line)) {
+    std::stringstream fields(line);
+    std::string key;
+    int color = 0;
+    int synchronized_output = 0;
+    if (!std::getline(fields, key, '\t') || key != identity) {
+      continue;
+    }
+    if (!(fields >> color >> synchronized_output) ||
+        color < Terminal::Color::Palette1 ||
+        color > Terminal::Color::TrueColor) {
+      return false;
+    }
+    capabilities->color = Terminal::Color(color);
+    capabilities->synchronized_output = synchronized_output != 0;
+    return true;
+  }
+  return false;
+}
+
+void WriteTerminalCapabilities(const std::string& file,
+                               const std::string& identity,
+                               const TerminalCapabilities& capabilities) {
+  // Keep the other terminals, up to kMaxCacheEntries - 1 of the most recent.
+  std::vector<std::string> lines;
+  {
+    std::ifstream input(file);
+    std::string line;
+    while (std::getline(input, line)) {
+      if (line.compare(0, identity.size() + 1, identity + '\t') != 0) {
+        lines.push_back(line);
+      }
+    }
+  }
+  const size_t kept = std::min(lines.size(), size_t(kMaxCacheEntries - 1));
+  std::string content;
+  for (size_t i = lines.size() - kept; i < lines.size(); ++i) {
+    content += lines[i] + '\n';
+  }
+  content += identity + '\t' + std::to_string(int(capabilities.color)) + '\t' +
+             (capabilities.synchronized_output ? "1" : "0") + '\n';
+
+  // Write a temporary file next to the cache, then rename it over the cache.
+  // Programs starting concurrently never read a partially written file.
+  const std::string temporary =
+      file + ".tmp" + std::to_string(std::random_device()());
+  {
+    std::ofstream output(temporary, std::ios::trunc);
+    output << content;
+    if (!output.flush()) {
+      output.close();
+      std::remove(temporary.c_str());
+      return;
+    }
+  }
+  if (std::rename(temporary.c_str(), file.c_str()) == 0) {
+    return;
+  }
+  // Windows doesn't replace an existing file.
+  std::remove(file.c_str());
+  if (std::rename(temporary.c_str(), file.c_str()) != 0) {
+    std::remove(temporary.c_str());
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,47 @@
+#ifndef FTXUI_SCREEN_TERMINAL_PROBE_HPP
+#define FTXUI_SCREEN_TERMINAL_PROBE_HPP
+
+#include <string>  // for string
+
+#include "ftxui/screen/terminal.hpp"  // for Terminal::Color
+
+namespace ftxui {
+
+struct TerminalCapabilities {
+  // Palette1 when the terminal didn't tell.
+  Terminal::Color color = Terminal::Color::Palette1;
+  bool synchronized_output = false;
+};
+
+// The queries sent to the terminal: XTGETTCAP for truecolor and the number of
+// colors, DECRQM for the synchronized output mode, and finally DA1. Every
+// terminal answers DA1, so its reply marks the end of the replies.
+std::string TerminalProbeQuery();
+
+// Whether |reply| contains the reply to DA1.
+bool TerminalProbeComplete(const std::string& reply);
+
+// Extract the capabilities from the replies of the terminal.
+TerminalCapabilities ParseTerminalProbe(const std::string& reply);
+
+// A string identifying the terminal, derived from the environment. It is used
+// as the key of the cache.
+std::string TerminalIdentity();
+
+// The cache is a text file, one terminal per line:
+// <identity>\t<color>\t<synchronized_output>
+// Only the 16 most recently written terminals are kept.
+bool ReadTerminalCapabilities(const std::string& file,
+                              const std::string& identity,
+                              TerminalCapabilities* capabilities);
+void WriteTerminalCapabilities(const std::string& file,
+                               const std::string& identity,
+                               const TerminalCapabilities& capabilities);
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_TERMINAL_PROBE_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
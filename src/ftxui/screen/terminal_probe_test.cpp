@@ -0,0 +1,157 @@
+#include "ftxui/screen/terminal_probe.hpp"
+
+#include <gtest/gtest.h>
+#include <cstdio>   // for remove
+#include <cstdlib>  // for setenv, unsetenv
+#include <fstream>  // for ifstream
+#include <string>   // for string, getline, to_string
+#include <thread>   // for thread
+#include <vector>   // for vector
+
+namespace ftxui {
+
+TEST(TerminalProbeTest, Query) {
+  const std::string query = TerminalProbeQuery();
+  // XTGETTCAP Tc:
+  EXPECT_NE(query.find("\x1BP+q5463\x1B\\"), std::string::npos);
+  // DA1 comes last:
+  EXPECT_EQ(query.substr(query.size() - 3), "\x1B[c");
+}
+
+TEST(TerminalProbeTest, Complete) {
+  EXPECT_FALSE(TerminalProbeComplete(""));
+  EXPECT_FALSE(TerminalProbeComplete("\x1B[>1;10;0c"));
+  EXPECT_FALSE(TerminalProbeComplete("\x1B[?2026;2$y"));
+  EXPECT_FALSE(TerminalProbeComplete("\x1B[?62;22"));
+  EXPECT_TRUE(TerminalProbeComplete("\x1B[>1;10;0c\x1B[?62;22c"));
+}
+
+TEST(TerminalProbeTest, NoReply) {
+  const TerminalCapabilities capabilities = ParseTerminalProbe("\x1B[?1;2c");
+  EXPECT_EQ(capabilities.color, Terminal::Color::Palette1);
+  EXPECT_FALSE(capabilities.synchronized_output);
+}
+
+TEST(TerminalProbeTest, TrueColor) {
+  const TerminalCapabilities capabilities = ParseTerminalProbe(
+      "\x1BP0+r5463\x1B\\"
+      "\x1BP1+r524742=382F382F38\x1B\\"
+      "\x1B[?2026;0$y"
+      "\x1B[?62;22c");
+  EXPECT_EQ(capabilities.color, Terminal::Color::TrueColor);
+  EXPECT_FALSE(capabilities.synchronized_output);
+}
+
+TEST(TerminalProbeTest, Colors) {
+  const TerminalCapabilities capabilities = ParseTerminalProbe(
+      "\x1BP1+r636f6c6f7273=323536\x1B\\"
+      "\x1B[?2026;2$y"
+      "\x1B[>1;10;0c"
+      "\x1B[?62;22c");
+  EXPECT_EQ(capabilities.color, Terminal::Color::Palette256);
+  EXPECT_TRUE(capabilities.synchronized_output);
+}
+
+TEST(TerminalProbeTest, Cache) {
+  const std::string file =
+      ::testing::TempDir() + "ftxui_terminal_probe_test_cache";
+  std::remove(file.c_str());
+
+  TerminalCapabilities capabilities;
+  EXPECT_FALSE(ReadTerminalCapabilities(file, "a", &capabilities));
+
+  WriteTerminalCapabilities(file, "a", {Terminal::Color::TrueColor, true});
+  WriteTerminalCapabilities(file, "b", {Terminal::Color::Palette16, false});
+  WriteTerminalCapabilities(file, "a", {Terminal::Color::Palette256, true});
+
+  EXPECT_TRUE(ReadTerminalCapabilities(file, "a", &capabilities));
+  EXPECT_EQ(capabilities.color, Terminal::Color::Palette256);
+  EXPECT_TRUE(capabilities.synchronized_output);
+
+  EXPECT_TRUE(ReadTerminalCapabilities(file, "b", &capabilities));
+  EXPECT_EQ(capabilities.color, Terminal::Color::Palette16);
+  EXPECT_FALSE(capabilities.synchronized_output);
+
+  EXPECT_FALSE(ReadTerminalCapabilities(file, "c", &capabilities));
+  std::remove(file.c_str());
+}
+
+TEST(TerminalProbeTest, CacheLimit) {
+  const std::string file =
+      ::testing::TempDir() + "ftxui_terminal_probe_test_limit";
+  std::remove(file.c_str());
+
+  for (int i = 0; i < 20; ++i) {
+    WriteTerminalCapabilities(file, std::to_string(i),
+                              {Terminal::Color::TrueColor, true});
+  }
+  // Writing an existing terminal again makes it the most recent.
+  WriteTerminalCapabilities(file, "4", {Terminal::Color::TrueColor, true});
+  WriteTerminalCapabilities(file, "20", {Terminal::Color::TrueColor, true});
+
+  TerminalCapabilities capabilities;
+  EXPECT_FALSE(ReadTerminalCapabilities(file, "3", &capabilities));
+  EXPECT_FALSE(ReadTerminalCapabilities(file, "5", &capabilities));
+  EXPECT_TRUE(ReadTerminalCapabilities(file, "4", &capabilities));
+  EXPECT_TRUE(ReadTerminalCapabilities(file, "6", &capabilities));
+  EXPECT_TRUE(ReadTerminalCapabilities(file, "20", &capabilities));
+
+  std::ifstream input(file);
+  std::string line;
+  int lines = 0;
+  while (std::getline(input, line)) {
+    lines++;
+  }
+  EXPECT_EQ(lines, 16);
+  std::remove(file.c_str());
+}
+
+// The cache is replaced at once. Readers never see it partially written.
+TEST(TerminalProbeTest, CacheConcurrentWrites) {
+  const std::string file =
+      ::testing::TempDir() + "ftxui_terminal_probe_test_concurrent";
+  std::remove(file.c_str());
+  WriteTerminalCapabilities(file, "a", {Terminal::Color::TrueColor, true});
+
+  std::vector<std::thread> writers;
+  for (int i = 0; i < 2; ++i) {
+    writers.emplace_back([&] {
+      for (int j = 0; j < 100; ++j) {
+        WriteTerminalCapabilities(file, "a",
+                                  {Terminal::Color::TrueColor, true});
+      }
+    });
+  }
+  int misses = 0;
+  for (int i = 0; i < 1000; ++i) {
+    TerminalCapabilities capabilities;
+    misses += ReadTerminalCapabilities(file, "a", &capabilities) ? 0 : 1;
+  }
+  for (auto& writer : writers) {
+    writer.join();
+  }
+  EXPECT_EQ(misses, 0);
+  std::remove(file.c_str());
+}
+
+#if !defined(_WIN32)
+// Every Windows Terminal tab has its own WT_SESSION. They share the cache.
+TEST(TerminalProbeTest, IdentityIgnoresSession) {
+  unsetenv("WT_SESSION");
+  const std::string outside = TerminalIdentity();
+  setenv("WT_SESSION", "a", 1);
+  const std::string a = TerminalIdentity();
+  setenv("WT_SESSION", "b", 1);
+  const std::string b = TerminalIdentity();
+  unsetenv("WT_SESSION");
+
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, outside);
+}
+#endif
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,54 @@
+#include "ftxui/screen/terminal.hpp"
+
+#include <gtest/gtest.h>
+#include <string>       // for string
+#include <string_view>  // for string_view
+
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+#if !defined(_WIN32)
+#include <unistd.h>  // for pipe, read, close
+#endif
+
+namespace ftxui {
+
+TEST(TerminalTest, Output) {
+  std::string output;
+  Terminal::SetOutput([&](std::string_view data) { output += data; });
+
+  Screen screen(3, 1);
+  screen.PixelAt(1, 0).character = "a";
+  screen.Print();
+  Terminal::Write("b");
+  Terminal::SetOutput(nullptr);
+
+  EXPECT_EQ(output, " a b");
+}
+
+#if !defined(_WIN32)
+TEST(TerminalTest, OutputFileDescriptor) {
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  Terminal::SetOutputFileDescriptor(fds[1]);
+  Terminal::Write("hello ");
+  Terminal::Write("world");
+  Terminal::SetOutput(nullptr);
+  close(fds[1]);
+
+  std::string output;
+  char buffer[64];
+  ssize_t size = 0;
+  while ((size = read(fds[0], buffer, sizeof(buffer))) > 0) {
+    output.append(buffer, size);
+  }
+  close(fds[0]);
+
+  EXPECT_EQ(output, "hello world");
+}
+#endif
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.